@@ -34,6 +34,37 @@ dnl Check for and set up MPI to build parallel OPT++.
    fi
    AM_CONDITIONAL([HAVE_MPI], [test "x$have_mpi" = xyes])
 
+dnl Check for POSIX threads to build the shared-memory parallel
+dnl evaluation paths of OPT++.
+
+   have_threads=no
+   AC_ARG_ENABLE(threads, AC_HELP_STRING([--disable-threads],
+			  [build OPT++ without POSIX threads support]),
+		[enable_threads=$enableval], [enable_threads=yes])
+
+   if test "x$enable_threads" = xyes; then
+      AC_LANG_PUSH([C])
+      AC_CHECK_HEADER([pthread.h],
+		      [AC_CHECK_LIB([pthread], [pthread_create],
+				    [LIBS="-lpthread $LIBS" have_threads=yes])])
+      AC_LANG_POP([C])
+   fi
+
+   optpp_thread_local=""
+   if test "x$have_threads" = xyes; then
+      AC_DEFINE(WITH_THREADS, 1, [Define if you are building threaded OPT++.])
+      AC_MSG_CHECKING([for __thread])
+      AC_LANG_PUSH([C])
+      AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[static __thread int x;]],
+					 [[x = 1; return x;]])],
+			[optpp_thread_local=__thread; AC_MSG_RESULT(yes)],
+			[AC_MSG_RESULT(no)])
+      AC_LANG_POP([C])
+   fi
+   AC_DEFINE_UNQUOTED(OPTPP_THREAD_LOCAL, [$optpp_thread_local],
+		      [Storage class of per-thread solver state.])
+   AM_CONDITIONAL([HAVE_THREADS], [test "x$have_threads" = xyes])
+
    have_xml=no
    AM_CONDITIONAL([HAVE_XML], [test "x$have_xml" = xyes])
 
@@ -38,12 +38,21 @@ class AppLauncher
 		string appName_;
 		 string appInput_;
 		 string appOutput_;
-		 static string appDir_;
+		 string appDir_;
+		 string workDir_;
 		 VariableList * variables_;
 
+		/** Sets up the working directory of this launcher: the
+		    model directory if createDir is set, else the
+		    current directory */
+		void setupDir(DOMElement* appXML, bool createDir);
+
+		/** Path of fileName inside the working directory */
+		string workPath(const char* fileName) const;
+
 	public:
 		/** no-arg Constructor*/
-		AppLauncher(){;}
+		AppLauncher(): variables_(0) {;}
 
 		/** no-variable Constructor */
 		AppLauncher(DOMElement* appXML, bool createDir);
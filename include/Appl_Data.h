@@ -19,6 +19,8 @@
 
 #include "globals.h"
 #include "OptppArray.h"
+#include "OptppProfile.h"
+#include "OptppSparseMatrix.h"
 
 /**
  * @author J. C. Meza, Sandia National Laboratories, meza@ca.sandia.gov
@@ -43,6 +45,8 @@ private :
   NEWMAT::ColumnVector    *constraint_value;	
   /// Gradient of the constraints 
   NEWMAT::Matrix          *constraint_gradient;	
+  /// Sparse gradient of the constraints 
+  OptppSparseMatrix       *constraint_sparse_gradient;
   /// Hessian of the constraints 
   OptppArray<NEWMAT::SymmetricMatrix> *constraint_Hessian; 
   /// Residuals of the least square objective function 
@@ -55,6 +59,11 @@ private :
   bool            gradient_current;		
   /// Is the Hessian current? 
   bool            Hessian_current;		
+  /// Profile counting the cache hits, if any
+  OptppProfile   *profile;
+
+  /// Account for a lookup answered from the cache
+  bool hit() { if (profile) profile->count(OptppProfile::CacheHits); return true;}
 
 public:
   /**
@@ -69,6 +78,9 @@ public:
 
   void reset();
 
+  /// Count cache hits in prof (0 turns counting off)
+  void setProfile(OptppProfile* prof) { profile = prof;}
+
   bool Compare(const NEWMAT::ColumnVector&);
   bool getF(const NEWMAT::ColumnVector&, real&);
   bool getGrad(const NEWMAT::ColumnVector&, NEWMAT::ColumnVector&);
@@ -76,6 +88,7 @@ public:
 
   bool getCF(const NEWMAT::ColumnVector&, NEWMAT::ColumnVector&);
   bool getCGrad(const NEWMAT::ColumnVector&, NEWMAT::Matrix&);
+  bool getCGrad(const NEWMAT::ColumnVector&, OptppSparseMatrix&);
   bool getCHess(const NEWMAT::ColumnVector&, OptppArray<NEWMAT::SymmetricMatrix>&);
 
   bool getLSQF(const NEWMAT::ColumnVector&, NEWMAT::ColumnVector&);
@@ -96,9 +109,16 @@ public:
   /// Update the nonlinear constraint functions and Jacobian
   void constraint_update(int,int,int,const NEWMAT::ColumnVector&,
     NEWMAT::ColumnVector&,NEWMAT::Matrix&);
+  /// Update the nonlinear constraint functions and sparse Jacobian
+  void constraint_update(int,int,int,const NEWMAT::ColumnVector&,
+    NEWMAT::ColumnVector&,OptppSparseMatrix&);
   /// Update the nonlinear constraint functions, Jacobian, and Hessians
   void constraint_update(int,int,int,const NEWMAT::ColumnVector&,
     NEWMAT::ColumnVector&,NEWMAT::Matrix&,OptppArray<NEWMAT::SymmetricMatrix>&);
+  /// Update the nonlinear constraint functions, sparse Jacobian, and Hessians
+  void constraint_update(int,int,int,const NEWMAT::ColumnVector&,
+    NEWMAT::ColumnVector&,OptppSparseMatrix&,
+    OptppArray<NEWMAT::SymmetricMatrix>&);
 
   /// Update the least square residuals 
   void lsq_update(int,int,int,const NEWMAT::ColumnVector&,NEWMAT::ColumnVector&);
@@ -200,6 +200,12 @@ private:
  * @return The gradient of the constraints.
  */
   virtual NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xc) const;
+/**
+ * Takes one argument and returns a sparse matrix.
+ * @param xc a ColumnVector
+ * @return The gradient of the constraints, one nonzero per column.
+ */
+  virtual OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xc) const;
 /**
  * Takes one argument and returns a SymmetricMatrix.
  * @param xc a ColumnVector
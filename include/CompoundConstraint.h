@@ -181,6 +181,13 @@ public:
    */
   virtual NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xcurrent ) const ;
 
+  /**
+   * Takes one argument and returns a sparse matrix.
+   * @param xcurrent a ColumnVector
+   * @return The gradient of the constraints, without dense copies.
+   */
+  virtual OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xcurrent ) const ;
+
   /**
    * Takes two arguments and returns a real SymmetricMatrix
    * @param xcurrent a ColumnVector
@@ -87,6 +87,12 @@ public:
  * @return The gradient of the constraints evaluated at xcurrent. 
  */
   NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xcurrent) const;
+/**
+ * Takes one argument and returns a sparse matrix.
+ * @param xcurrent a ColumnVector 
+ * @return The gradient of the constraints evaluated at xcurrent. 
+ */
+  OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xcurrent) const;
 /**
  * Takes one argument and returns a SymmetricMatrix
  * @param xcurrent a ColumnVector 
@@ -19,6 +19,7 @@
 #include "OptppArray.h"
 #include "OptppExceptions.h"
 #include "OptppFatalError.h"
+#include "OptppSparseMatrix.h"
 
 double const MIN_BND = -FLT_MAX;
 double const MAX_BND =  FLT_MAX;
@@ -99,6 +100,14 @@ public:
     * @return The gradient of the constraints evaluated at xcurrent.
     */
    virtual NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xcurrent) const = 0;
+  /**
+    * Takes one argument and returns a sparse matrix.  By default the
+    * nonzeros of evalGradient(xcurrent).
+    * @param xcurrent a ColumnVector
+    * @return The gradient of the constraints evaluated at xcurrent.
+    */
+   virtual OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xcurrent) const 
+     { return OptppSparseMatrix(evalGradient(xcurrent));}
 
    /**
     * Takes one arguments and returns a SymmetricMatrix
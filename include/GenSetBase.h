@@ -27,6 +27,7 @@
 #endif
 
 #include "newmatap.h"
+#include "OptppArray.h"
 
 using std::cerr;
 using std::string;
@@ -41,8 +42,19 @@ class GenSetBase {  // Generating Set Base Class
   int  Size;
   int  nAct;
 
-  NEWMAT::ColumnVector ActiveIDs;
-  NEWMAT::ColumnVector InactiveIDs;
+  OptppArray<int> ActiveIDs;       ///< ids of the active directions
+  OptppArray<int> InactiveIDs;     ///< ids of the inactive directions
+
+  OptppArray<int>    nzIdx;        ///< workspace for nonzeros()
+  OptppArray<double> nzVal;        ///< workspace for nonzeros()
+  NEWMAT::ColumnVector work;       ///< workspace for dense directions
+
+  /// Copies x into y, reusing the storage of y when the sizes agree
+  static void copyPoint(const NEWMAT::ColumnVector& x, NEWMAT::ColumnVector& y);
+
+  /// Fills columns col,... of M with X + a*d_j for the n directions ids[j]
+  bool generateColumns(const int *ids, int n, double a, 
+		       const NEWMAT::ColumnVector& X, NEWMAT::Matrix& M, int col);
 
  public:
   virtual string classnm() { return "GenSetBase";}; 
@@ -84,6 +96,18 @@ class GenSetBase {  // Generating Set Base Class
     NEWMAT::ColumnVector &y) = 0;  
   ///< Stores in y the vector  x + a*d_i
 
+  /**
+   * Sparse form of d_i: stores the (1-based) row indices and values of
+   * its nonzero entries in idx and val and returns their number, at
+   * most maxNonzeros().  Every implementation returns -1 when d_i has
+   * no sparse form, including for an index out of range; d_i is then
+   * left to generate().  This is the default.
+   */
+  virtual int nonzeros(int, int*, double*) { return -1; }
+
+  /// Upper bound on the number of nonzeros of any direction
+  virtual int maxNonzeros() { return Vdim; }
+
   // -- wrt ACTIVE Directions --
   /*
   virtual 
@@ -139,16 +163,22 @@ class GenSetBase {  // Generating Set Base Class
       return;
     }
     nAct = Size;
-    ActiveIDs.ReSize(Size);
-    for (int i=1; i<=Size; i++) ActiveIDs(i) = i; 
-    InactiveIDs.ReSize(Size); 
-    InactiveIDs = 0;
+    ActiveIDs.resize(Size);
+    for (int i=0; i<Size; i++) ActiveIDs[i] = i+1; 
+    InactiveIDs.resize(Size); 
   }
 
   virtual int nActive() { return nAct; }
   virtual int nInactive() { return (Size - nAct); }
-  virtual int activeID(int j) { return static_cast<int>(ActiveIDs(j)); }
-  virtual int inactiveID(int j) { return static_cast<int>(InactiveIDs(j)); }
+  virtual int activeID(int j) { return ActiveIDs[j-1]; }
+  virtual int inactiveID(int j) { return InactiveIDs[j-1]; }
+
+  /// The pruned set as a whole, saved and restored by OptGSS checkpoints
+  void getActive(int& n, OptppArray<int>& act, OptppArray<int>& inact)
+    { n = nAct; act = ActiveIDs; inact = InactiveIDs; }
+  void setActive(int n, const OptppArray<int>& act,
+		 const OptppArray<int>& inact)
+    { nAct = n; ActiveIDs = act; InactiveIDs = inact; }
 
   virtual int init(){ return 0;}    ///< Computes initial generating set D
   virtual int init(NEWMAT::ColumnVector& pV){ return 0;}    
@@ -185,6 +215,16 @@ class GenSetBase {  // Generating Set Base Class
     return generateAllActive(X,Delta); 
   }
 
+  /**
+   * Batched trial points: stores X + Delta*Act_i, i = imin,...,imax,
+   * in columns col,...,col+imax-imin of M.  M is written in place and
+   * directions with a sparse form cost only their nonzeros on top of
+   * the copies of X.
+   */
+  bool generateActiveBatch(int imin, int imax, double Delta, 
+			   const NEWMAT::ColumnVector& X, NEWMAT::Matrix& M,
+			   int col=1);
+
   NEWMAT::Matrix pllMesh(int P, NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& xn, double d=0.0);
 
 }; // end of GenSetBase class
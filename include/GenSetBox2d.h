@@ -36,6 +36,10 @@ class GenSetBox2d : public GenSetBase {  // Standard with 2*n vectors
   void generate(int i, double a, NEWMAT::ColumnVector &x, NEWMAT::ColumnVector &y);
   ///< Stores the search direction in the vector y
 
+  int nonzeros(int i, int *idx, double *val);
+  ///< Sparse form of the coordinate directions
+  int maxNonzeros() { return 1; }
+
   // overloaded pruning methods - virtual in base
   int init(){ return 0;}    ///< Computes initial generating set D
   int init(NEWMAT::ColumnVector& pV);  
@@ -38,6 +38,10 @@ class GenSetMin : public GenSetBase {
   void generate(int i, double a, NEWMAT::ColumnVector &x, NEWMAT::ColumnVector &y);
   ///< Stores the search direction in the vector y
 
+  int nonzeros(int i, int *idx, double *val);
+  ///< Sparse form of the coordinate directions
+  int maxNonzeros() { return 1; }
+
   //
   // pruning methods - virtual in base
   //
@@ -31,6 +31,23 @@ typedef void (*USERFCNLSQ0)(int, const NEWMAT::ColumnVector&,
 typedef void (*USERFCNLSQ0V)(int, const NEWMAT::ColumnVector&, 
   NEWMAT::ColumnVector&, int&, void* v);
 
+/**
+ * Residuals first,...,last (1 <= first <= last <= lsqterms) at x,
+ * stored in fx(first),...,fx(last).  The other entries of fx belong
+ * to other blocks, possibly being evaluated at the same time.
+ */
+typedef void (*USERFCNLSQ0B)(int, const NEWMAT::ColumnVector&, int, int,
+  NEWMAT::ColumnVector&, int&, void* v);
+
+/**
+ * Streaming residuals: for mode NLPFunction, residuals first,...,last
+ * at x in fx(1),...,fx(last-first+1); if mode includes NLPGradient,
+ * the matching rows of the Jacobian in the (last-first+1) x ndim
+ * matrix jx as well.  jx is empty when the Jacobian is not requested.
+ */
+typedef void (*USERFCNLSQS)(int, int, const NEWMAT::ColumnVector&, int, int,
+  NEWMAT::ColumnVector&, NEWMAT::Matrix&, int&, void* v);
+
 typedef void (*USERFCNLSQ1)(int, int, const NEWMAT::ColumnVector&, 
   NEWMAT::ColumnVector&, NEWMAT::Matrix&, int&);
 
@@ -74,6 +91,16 @@ protected:
   NEWMAT::Matrix Jacobian_;	///< Jacobian_ of objective function residuals
   NEWMAT::Matrix partial_jac;
   void* vptr; 			///< Void pointer 
+  USERFCNLSQ0B fcn0_b;		///< User-defined residual blocks
+  int block_size;		///< Residuals per block, 0 for one per thread
+  void* bptr;			///< Void pointer passed to fcn0_b or fcn_s
+  USERFCNLSQS fcn_s;		///< User-defined streaming residuals
+  NEWMAT::UpperTriangularMatrix stream_R; ///< R of the QR of [J r]
+  NEWMAT::ColumnVector stream_x;	///< Point of stream_R
+  int broyden_every;		///< Broyden updates between difference Jacobians
+  int broyden_updates;		///< Updates since the last difference Jacobian
+  NEWMAT::ColumnVector broyden_x;	///< Point of Jacobian_
+  NEWMAT::ColumnVector broyden_f;	///< Residuals at broyden_x
 
   static void f0_helper(int n, const NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& f, 
          int& result, void *v) 
@@ -81,6 +108,9 @@ protected:
   static void f1_helper(int m, int n, const NEWMAT::ColumnVector& xc, 
          NEWMAT::ColumnVector& f, NEWMAT::Matrix& g, int& result, void *v) 
         {LSQNLF *o = (LSQNLF*)v; (*o->fcn1)(m,n,xc,f,g,result);}
+  static void f0b_helper(int, const NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& f, 
+         int& result, void *v) 
+        {LSQNLF *o = (LSQNLF*)v; o->evalBlocks(xc,f,result,o->nthreads);}
 
 private:
   NEWMAT::ColumnVector tempF;   ///< Vector of objective function residuals 
@@ -98,6 +128,8 @@ public:
     init_fcn(0), init_confcn(0), init_flag(false), Jacobian_current(false), 
     lsqterms_(lsqterms), fvector(lsqterms), 
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
      {
 	 fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -109,6 +141,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -120,6 +154,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -130,6 +166,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -140,6 +178,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -151,6 +191,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(v),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -161,11 +203,55 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(v),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
+    tempF(lsqterms), specLSQF(lsqterms)
+    { 
+	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
+	SpecFlag = Spec1;
+    }
+  /**
+   * Residuals computed by blocks of terms: f(ndim, x, first, last, fx,
+   * result, v) fills fx(first),...,fx(last).  With setNumThreads(p),
+   * p > 1, the blocks of one residual vector, or the residual vectors
+   * of a finite-difference Jacobian, are evaluated on p threads.
+   * @param blocksize number of terms per block, 0 for one block per
+   * thread
+   */
+  LSQNLF(int ndim, int lsqterms, USERFCNLSQ0B f, int blocksize, INITFCN i, 
+	  CompoundConstraint* constraint = 0, void* v = 0): 
+    NLP2(ndim, constraint), fcn0(0), fcn0_v(f0b_helper), fcn1(0), fcn1_v(0), 
+    confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
+    Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
+    Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(f), block_size(blocksize), bptr(v), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
 	SpecFlag = Spec1;
     }
+  /**
+   * Streaming least squares: f(mode, ndim, x, first, last, fx, jx,
+   * result, v) returns one block of residuals, and of Jacobian rows,
+   * at a time.  Only R and Q'r of the QR factorization of the
+   * Jacobian are kept, updated block by block, so memory is
+   * O(ndim^2 + blocksize*ndim) whatever the number of terms, and
+   * getJacobian() and getFcnResidual() return empty objects.
+   * @param blocksize number of terms per block
+   */
+  LSQNLF(int ndim, int lsqterms, USERFCNLSQS f, int blocksize, INITFCN i, 
+	  CompoundConstraint* constraint = 0, void* v = 0): 
+    NLP2(ndim, constraint), fcn0(0), fcn0_v(0), fcn1(0), fcn1_v(0), 
+    confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
+    Jacobian_current(false), lsqterms_(lsqterms), vptr(this),
+    fcn0_b(0), block_size(blocksize), bptr(v), fcn_s(f),
+    stream_R(ndim+1), stream_x(ndim),
+    broyden_every(0), broyden_updates(-1)
+    { 
+	stream_R = 0.0;
+	SpecFlag = Spec1;
+    }
 
 #else
 
@@ -176,6 +262,8 @@ public:
     init_fcn(0), init_confcn(0), init_flag(false), Jacobian_current(false), 
     lsqterms_(lsqterms), fvector(lsqterms), 
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
      {
 	 fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -187,6 +275,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -198,6 +288,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -208,6 +300,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -218,6 +312,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -229,6 +325,8 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(v),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
@@ -239,11 +337,55 @@ public:
     confcn(0), init_fcn(i), init_confcn(c), init_flag(false), 
     Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
     Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(v),
+    fcn0_b(0), block_size(0), bptr(0), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
     tempF(lsqterms), specLSQF(lsqterms)
     { 
 	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
 	SpecFlag = NoSpec;
     }
+  /**
+   * Residuals computed by blocks of terms: f(ndim, x, first, last, fx,
+   * result, v) fills fx(first),...,fx(last).  With setNumThreads(p),
+   * p > 1, the blocks of one residual vector, or the residual vectors
+   * of a finite-difference Jacobian, are evaluated on p threads.
+   * @param blocksize number of terms per block, 0 for one block per
+   * thread
+   */
+  LSQNLF(int ndim, int lsqterms, USERFCNLSQ0B f, int blocksize, INITFCN i, 
+	  CompoundConstraint* constraint = 0, void* v = 0): 
+    NLP2(ndim, constraint), fcn0(0), fcn0_v(f0b_helper), fcn1(0), fcn1_v(0), 
+    confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
+    Jacobian_current(false), lsqterms_(lsqterms), fvector(lsqterms),
+    Jacobian_(lsqterms,ndim), partial_jac(lsqterms,ndim), vptr(this),
+    fcn0_b(f), block_size(blocksize), bptr(v), fcn_s(0),
+    broyden_every(0), broyden_updates(-1),
+    tempF(lsqterms), specLSQF(lsqterms)
+    { 
+	fvector = 1.0e30;  Jacobian_ = 1.0e30; tempF = 1.0e30;
+	SpecFlag = NoSpec;
+    }
+  /**
+   * Streaming least squares: f(mode, ndim, x, first, last, fx, jx,
+   * result, v) returns one block of residuals, and of Jacobian rows,
+   * at a time.  Only R and Q'r of the QR factorization of the
+   * Jacobian are kept, updated block by block, so memory is
+   * O(ndim^2 + blocksize*ndim) whatever the number of terms, and
+   * getJacobian() and getFcnResidual() return empty objects.
+   * @param blocksize number of terms per block
+   */
+  LSQNLF(int ndim, int lsqterms, USERFCNLSQS f, int blocksize, INITFCN i, 
+	  CompoundConstraint* constraint = 0, void* v = 0): 
+    NLP2(ndim, constraint), fcn0(0), fcn0_v(0), fcn1(0), fcn1_v(0), 
+    confcn(0), init_fcn(i), init_confcn(0), init_flag(false), 
+    Jacobian_current(false), lsqterms_(lsqterms), vptr(this),
+    fcn0_b(0), block_size(blocksize), bptr(v), fcn_s(f),
+    stream_R(ndim+1), stream_x(ndim),
+    broyden_every(0), broyden_updates(-1)
+    { 
+	stream_R = 0.0;
+	SpecFlag = NoSpec;
+    }
 
 #endif
 
@@ -252,6 +394,32 @@ public:
 
   void setFcnResidual(NEWMAT::ColumnVector& f) {tempF = f;}
   NEWMAT::ColumnVector getFcnResidual() const {return tempF;}
+  /// Number of least square terms (residuals)
+  int getLSQTerms() const {return lsqterms_;}
+  /// Jacobian of the residuals from the last call to evalG()
+  NEWMAT::Matrix getJacobian() const {return Jacobian_;}
+  /**
+   * QR factorization J = QR of the Jacobian from the last call to
+   * evalG(), and Q'r for the residuals at the same point
+   */
+  void getQR(NEWMAT::UpperTriangularMatrix& R, NEWMAT::ColumnVector& qtr);
+  /// Are the residuals produced block by block?
+  bool isStreaming() const {return fcn_s != 0;}
+
+  /**
+   * Without an analytic Jacobian, replace the difference Jacobian in
+   * evalG() by Broyden's rank-one update
+   *
+   *      J+ = J + (y - J s) s' / s's,   s = x+ - x,  y = r(x+) - r(x),
+   *
+   * for up to every consecutive points, after which a difference
+   * Jacobian is computed again.  every = 0 turns the updates off.
+   */
+  void setBroydenUpdate(int every) {broyden_every = (every < 0)? 0 : every;}
+  /// Compute a difference Jacobian at the next evalG()
+  void refreshJacobian() {broyden_updates = -1;}
+  /// Is the current Jacobian a Broyden update?
+  bool isJacobianUpdated() const {return broyden_updates > 0;}
 
   /// Reset parameters 
   virtual void reset();          
@@ -263,6 +431,8 @@ public:
   virtual real evalF();                         	
   /// Evaluate the function at x 
   virtual real evalF(const NEWMAT::ColumnVector& x);    	
+  /// Call the user function at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
   /// Evaluate a finite-difference gradient 
   virtual NEWMAT::ColumnVector evalG();              		
   /// Evaluate a finite-difference gradient at x 
@@ -289,6 +459,18 @@ private:
     int darg);
   virtual void evalC(const NEWMAT::ColumnVector& x);  	
 
+  /// Evaluate the residual blocks at x on up to nthr threads
+  void evalBlocks(const NEWMAT::ColumnVector& x, NEWMAT::ColumnVector& f,
+    int& result, int nthr);
+  /// Evaluate the residuals at the columns of X on the NLP's threads
+  void evalResidualColumns(const NEWMAT::Matrix& X, NEWMAT::Matrix& F);
+  static int blockTask(int k, void* v);
+  /// Broyden update of Jacobian_ to mem_xc; false if J must be recomputed
+  bool updateJacobian();
+  /// Stream the residual blocks at x, updating stream_R if J is wanted
+  real streamLSQ(const NEWMAT::ColumnVector& x, int mode);
+  static int columnTask(int j, void* v);
+
   /// Construct forward finite-difference Jacobian of objective funtion 
   NEWMAT::Matrix LSQFDJac(const NEWMAT::ColumnVector& sx, 
     const NEWMAT::ColumnVector& xc, NEWMAT::ColumnVector& fx, 
@@ -49,9 +49,18 @@ typedef void (*USERNLNCON0)(int, const NEWMAT::ColumnVector&, NEWMAT::ColumnVect
 typedef void (*USERNLNCON1)(int, int, const NEWMAT::ColumnVector&,
   NEWMAT::ColumnVector&, NEWMAT::Matrix&, int&);
 
+/// As USERNLNCON1, filling a sparse ndim x ncnln constraint gradient
+typedef void (*USERNLNCON1S)(int, int, const NEWMAT::ColumnVector&,
+  NEWMAT::ColumnVector&, OptppSparseMatrix&, int&);
+
 typedef void (*USERNLNCON2)(int, int, const NEWMAT::ColumnVector&, 
   NEWMAT::ColumnVector&, NEWMAT::Matrix&, OptppArray<NEWMAT::SymmetricMatrix>&, int&);
 
+/// As USERNLNCON2, filling a sparse ndim x ncnln constraint gradient
+typedef void (*USERNLNCON2S)(int, int, const NEWMAT::ColumnVector&,
+  NEWMAT::ColumnVector&, OptppSparseMatrix&,
+  OptppArray<NEWMAT::SymmetricMatrix>&, int&);
+
 
 //
 //  Derived from NLP's
@@ -126,6 +135,8 @@ public:
   virtual real evalF();               		
   /// Evaluate the function at x
   virtual real evalF(const NEWMAT::ColumnVector& x); 	
+  /// Call the user function at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
   /// Evaluate nonlinear constraints at x 
   virtual NEWMAT::ColumnVector evalCF(const NEWMAT::ColumnVector& x); 	
 
@@ -173,6 +184,7 @@ protected:
   USERFCN1 fcn;			///< User-defined objective function
   USERFCN1V fcn_v;		///< User-defined objective function w/ void ptr
   USERNLNCON1 confcn;		///< User-defined constraints
+  USERNLNCON1S confcn_s;	///< User-defined constraints, sparse gradient
   INITFCN init_fcn;		///< Initializes the objective function
   INITCONFCN init_confcn;	///< Initializes of the constraints
   bool init_flag;		///< Has the function been initialized?
@@ -186,30 +198,38 @@ protected:
 public:
   // Constructors
   NLF1(): 
-     NLP1(){;}
+     NLP1(), confcn_s(0){;}
   NLF1(int ndim): 
-     NLP1(ndim){;}
+     NLP1(ndim), confcn_s(0){;}
   NLF1(int ndim, USERFCN1 f, INITFCN i, CompoundConstraint* constraint = 0):
-     NLP1(ndim, constraint), fcn(f), fcn_v(f_helper), init_fcn(i), 
-     init_flag(false), vptr(this)
+     NLP1(ndim, constraint), fcn(f), fcn_v(f_helper), confcn_s(0),
+     init_fcn(i), init_flag(false), vptr(this)
      {analytic_grad = 1;}
   NLF1(int ndim, USERFCN1 f, INITFCN i, INITCONFCN c):
-     NLP1(ndim), fcn(f), fcn_v(f_helper), init_fcn(i), init_confcn(c), 
-     init_flag(false), vptr(this)
+     NLP1(ndim), fcn(f), fcn_v(f_helper), confcn_s(0), init_fcn(i),
+     init_confcn(c), init_flag(false), vptr(this)
      {analytic_grad = 1; constraint_ = init_confcn(ndim);}
   NLF1(int ndim, int nlncons, USERNLNCON1 f, INITFCN i):
-     NLP1(ndim,nlncons), confcn(f), init_fcn(i), init_flag(false), vptr(this)
+     NLP1(ndim,nlncons), confcn(f), confcn_s(0), init_fcn(i), 
+     init_flag(false), vptr(this)
+     {analytic_grad = 1;}
+  /// Nonlinear constraints whose gradient is returned as a sparse matrix
+  NLF1(int ndim, int nlncons, USERNLNCON1S f, INITFCN i):
+     NLP1(ndim,nlncons), confcn(0), confcn_s(f), init_fcn(i), 
+     init_flag(false), vptr(this)
      {analytic_grad = 1;}
   /// Alternate function pointers with user-supplied void function pointer
   NLF1(int ndim, USERFCN1V f, INITFCN i, CompoundConstraint* constraint = 0, void* v = 0):
-     NLP1(ndim, constraint), fcn(0), fcn_v(f), init_fcn(i), init_flag(false) 
+     NLP1(ndim, constraint), fcn(0), fcn_v(f), confcn_s(0), init_fcn(i),
+     init_flag(false) 
      { analytic_grad = 1; if (v == 0) vptr = this; else vptr= v ;}
   NLF1(int ndim, USERFCN1V f, INITFCN i, void* v):
-     NLP1(ndim), fcn(0), fcn_v(f), init_fcn(i), init_flag(false), vptr(v)
+     NLP1(ndim), fcn(0), fcn_v(f), confcn_s(0), init_fcn(i), 
+     init_flag(false), vptr(v)
      {analytic_grad = 1;}
   NLF1(int ndim, USERFCN1V f, INITFCN i, INITCONFCN c, void* v):
-     NLP1(ndim), fcn(0), fcn_v(f), init_fcn(i), init_confcn(c), 
-     init_flag(false), vptr(v)
+     NLP1(ndim), fcn(0), fcn_v(f), confcn_s(0), init_fcn(i), 
+     init_confcn(c), init_flag(false), vptr(v)
      {analytic_grad = 1; constraint_ = init_confcn(ndim);}
 
   // Destructor
@@ -230,6 +250,9 @@ public:
   /// Evaluate the objective function at x 
   virtual real evalF(const NEWMAT::ColumnVector& x);  	
 
+  /// Call the user function at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
+
   /// Evaluate the gradient of the objective function 
   virtual NEWMAT::ColumnVector evalG();              	
 
@@ -255,6 +278,8 @@ public:
   virtual NEWMAT::ColumnVector evalCF(const NEWMAT::ColumnVector& x);  	
   /// Evaluate the gradient of the nonlinear constraints at x
   virtual NEWMAT::Matrix evalCG(const NEWMAT::ColumnVector& x);  	
+  /// Evaluate the gradient of the nonlinear constraints at x, sparse
+  virtual OptppSparseMatrix evalCGSparse(const NEWMAT::ColumnVector& x);
   /// Evaluate the Hessian of the nonlinear constraints at x
   virtual NEWMAT::SymmetricMatrix evalCH(NEWMAT::ColumnVector &x);	
   // Evaluate constraint hessian at x
@@ -278,6 +303,7 @@ protected:
   USERFCN2V fcn_v;	        ///< User-defined objective function
   USERNLNCON1 confcn1;		///< User-defined nonlinear constraints 
   USERNLNCON2 confcn2;		///< User-defined nonlinear constraints 
+  USERNLNCON2S confcn2s;	///< User-defined constraints, sparse gradient
   INITFCN init_fcn;		///< Initializes the objective function
   INITCONFCN init_confcn;	///< Initializes the constraints
   bool init_flag;		///< Has the function been initialized?
@@ -290,32 +316,37 @@ protected:
 public:
   // Constructors
   NLF2(): 
-     NLP2(){;}
+     NLP2(), confcn2s(0){;}
   NLF2(int ndim): 
-     NLP2(ndim){;}
+     NLP2(ndim), confcn2s(0){;}
   NLF2(int ndim, USERFCN2 f, INITFCN i, CompoundConstraint* constraint = 0):
-     NLP2(ndim, constraint), fcn(f), fcn_v(f_helper), init_fcn(i), 
-     init_flag(false), vptr(this) {;}
+     NLP2(ndim, constraint), fcn(f), fcn_v(f_helper), confcn2s(0),
+     init_fcn(i), init_flag(false), vptr(this) {;}
   NLF2(int ndim, USERFCN2 f, INITFCN i, INITCONFCN c):
-     NLP2(ndim), fcn(f), fcn_v(f_helper), init_fcn(i), init_confcn(c), 
-     init_flag(false), vptr(this)
+     NLP2(ndim), fcn(f), fcn_v(f_helper), confcn2s(0), init_fcn(i),
+     init_confcn(c), init_flag(false), vptr(this)
      {constraint_ = init_confcn(ndim);}
   NLF2(int ndim, int nlncons, USERNLNCON1 f, INITFCN i):
-     NLP2(ndim, nlncons), confcn1(f), confcn2(NULL), init_fcn(i), 
-     init_flag(false), vptr(this) {;}
+     NLP2(ndim, nlncons), confcn1(f), confcn2(NULL), confcn2s(0),
+     init_fcn(i), init_flag(false), vptr(this) {;}
   NLF2(int ndim, int nlncons, USERNLNCON2 f, INITFCN i):
-     NLP2(ndim, nlncons), confcn1(NULL), confcn2(f), init_fcn(i), 
-     init_flag(false), vptr(this) {;}
+     NLP2(ndim, nlncons), confcn1(NULL), confcn2(f), confcn2s(0),
+     init_fcn(i), init_flag(false), vptr(this) {;}
+  /// Nonlinear constraints whose gradient is returned as a sparse matrix
+  NLF2(int ndim, int nlncons, USERNLNCON2S f, INITFCN i):
+     NLP2(ndim, nlncons), confcn1(NULL), confcn2(NULL), confcn2s(f),
+     init_fcn(i), init_flag(false), vptr(this) {;}
   /// Alternate function pointers with user-supplied void function pointer
   NLF2(int ndim, USERFCN2V f, INITFCN i, CompoundConstraint* constraint = 0, void* v = 0):
-     NLP2(ndim, constraint), fcn(0), fcn_v(f), init_fcn(i), init_flag(false) 
+     NLP2(ndim, constraint), fcn(0), fcn_v(f), confcn2s(0), init_fcn(i),
+     init_flag(false) 
      { if (v == 0) vptr = this; else vptr= v ;}
   NLF2(int ndim, USERFCN2V f, INITFCN i, void* v):
-     NLP2(ndim), fcn(0), fcn_v(f), init_fcn(i), 
+     NLP2(ndim), fcn(0), fcn_v(f), confcn2s(0), init_fcn(i), 
      init_flag(false), vptr(v) {;}
   NLF2(int ndim, USERFCN2V f, INITFCN i, INITCONFCN c, void* v):
-     NLP2(ndim), fcn(0), fcn_v(f), init_fcn(i), init_confcn(c), 
-     init_flag(false), vptr(v)
+     NLP2(ndim), fcn(0), fcn_v(f), confcn2s(0), init_fcn(i),
+     init_confcn(c), init_flag(false), vptr(v)
      {constraint_ = init_confcn(ndim);}
 
   // Destructor
@@ -337,6 +368,9 @@ public:
   /// Evaluate the objective function at x 
   virtual real evalF(const NEWMAT::ColumnVector& x);    	
 
+  /// Call the user function at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
+
   /// Evaluate the analytic gradient of the objective function 
   virtual NEWMAT::ColumnVector evalG();              		
 
@@ -367,6 +401,9 @@ private:
   /// Evaluate the gradient of the nonlinear constraints at x
   virtual NEWMAT::Matrix evalCG(const NEWMAT::ColumnVector& x);  	
 
+  /// Evaluate the gradient of the nonlinear constraints at x, sparse
+  virtual OptppSparseMatrix evalCGSparse(const NEWMAT::ColumnVector& x);
+
   /// Evaluate the Hessian of the nonlinear constraints at x
   virtual NEWMAT::SymmetricMatrix evalCH(NEWMAT::ColumnVector &x);	
 
@@ -445,6 +482,9 @@ public:
   /// Evaluate the objective function at 
   virtual real evalF(const NEWMAT::ColumnVector& x);    	
 
+  /// Call the user function at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
+
   /// Evaluate the gradient of the objective function 
   virtual NEWMAT::ColumnVector evalG();              		
 
@@ -163,6 +163,9 @@ public:
   /// Evaluate the constraint gradient at x 
   NEWMAT::Matrix evalCG(const NEWMAT::ColumnVector& x);  
 
+  /// Evaluate the constraint gradient at x, as a sparse matrix 
+  OptppSparseMatrix evalCGSparse(const NEWMAT::ColumnVector& x);  
+
   /// Evaluate the constraint Hessian at x 
   NEWMAT::SymmetricMatrix evalCH(NEWMAT::ColumnVector& x);   
 
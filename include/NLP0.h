@@ -8,11 +8,15 @@
 #include "NLPBase.h"
 #include "Appl_Data.h"
 #include "CompoundConstraint.h"
+#include "OptppProfile.h"
 
 using std::ostream;
 
 namespace OPTPP {
 
+/// Stores point j of a batch of trial points in x (see NLP0::evalFBatch)
+typedef void (*OPTPP_POINTFCN)(int j, NEWMAT::ColumnVector& x, void* data);
+
 /**
  *
  * Base Class for NonLinear Programming Problem
@@ -38,6 +42,8 @@ protected:
   bool         debug_;			///< Print debug statements
   bool         modeOverride;	        
   double       function_time;		///< Function compute time
+  int          nthreads;		///< Threads used for concurrent evaluations
+  OptppProfile* profile;		///< Optional timers and counters
   CompoundConstraint* constraint_;  	///< Pointer to constraints
   NEWMAT::ColumnVector  constraint_value;///< Constraint residual 
   int          ncnln;      		///< Number of nonlinear constraints   
@@ -60,7 +66,7 @@ public:
   NLP0():
     dim(0),mem_xc(0),fvalue(1.0e30), mem_fcn_accrcy(0),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(0), ncnln(0), partial_grad(0)
+    nthreads(1), profile(0), constraint_(0), constraint_value(0), ncnln(0), partial_grad(0)
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = Spec1;}
  /**
@@ -72,7 +78,7 @@ public:
   NLP0(int ndim):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(0), ncnln(0), partial_grad(ndim)
+    nthreads(1), profile(0), constraint_(0), constraint_value(0), ncnln(0), partial_grad(ndim)
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = Spec1;}
  /**
@@ -85,7 +91,7 @@ public:
   NLP0(int ndim, int nlncons):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(nlncons), ncnln(nlncons),
+    nthreads(1), profile(0), constraint_(0), constraint_value(nlncons), ncnln(nlncons),
     partial_grad(ndim)
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = Spec1; constraint_value = 0;}
@@ -99,7 +105,7 @@ public:
   NLP0(int ndim, CompoundConstraint* constraint):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(constraint), constraint_value(0), ncnln(0), partial_grad(ndim) 
+    nthreads(1), profile(0), constraint_(constraint), constraint_value(0), ncnln(0), partial_grad(ndim) 
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = Spec1;}
 
@@ -115,7 +121,7 @@ public:
   NLP0():
     dim(0),mem_xc(0),fvalue(1.0e30), mem_fcn_accrcy(0),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(0), ncnln(0), partial_grad(0) 
+    nthreads(1), profile(0), constraint_(0), constraint_value(0), ncnln(0), partial_grad(0) 
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = NoSpec;}
  /**
@@ -127,7 +133,7 @@ public:
   NLP0(int ndim):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(0), ncnln(0), partial_grad(ndim)
+    nthreads(1), profile(0), constraint_(0), constraint_value(0), ncnln(0), partial_grad(ndim)
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = NoSpec;}
  /**
@@ -140,7 +146,7 @@ public:
   NLP0(int ndim, int nlncons):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(0), constraint_value(nlncons), ncnln(nlncons),
+    nthreads(1), profile(0), constraint_(0), constraint_value(nlncons), ncnln(nlncons),
     partial_grad(ndim)
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = NoSpec; constraint_value = 0;}
@@ -154,7 +160,7 @@ public:
   NLP0(int ndim, CompoundConstraint* constraint):
     dim(ndim),mem_xc(ndim),fvalue(1.0e30), mem_fcn_accrcy(ndim),
     nfevals(0),is_expensive(0),debug_(0), modeOverride(0), function_time(0.0), 
-    constraint_(constraint), constraint_value(0), ncnln(0),
+    nthreads(1), profile(0), constraint_(constraint), constraint_value(0), ncnln(0),
     partial_grad(ndim) 
     {mem_xc = 0; mem_fcn_accrcy = DBL_EPSILON; finitediff = ForwardDiff;
     SpecFlag = NoSpec;}
@@ -180,6 +186,8 @@ public:
    * @return Number of Function Evaluations 
    */
   virtual int  getFevals()      	const {return nfevals;}
+  /// Set the number of function evaluations, e.g. on a restart
+  void setFevals(int n) {nfevals = n;}
   /**
    * @return Is the function expensive? 
    */
@@ -228,6 +236,53 @@ public:
   virtual real evalF()   = 0;
   virtual real evalF(const NEWMAT::ColumnVector& x) = 0;
 
+  /**
+   * Evaluate the objective at each column of X, using up to
+   * getNumThreads() threads when the problem supports it.
+   * Evaluation stops early once a value below fstop has been found;
+   * fx(j) is set to DBL_MAX for the columns that were not evaluated.
+   * @return Number of columns evaluated
+   */
+  virtual int evalFBatch(const NEWMAT::Matrix& X, NEWMAT::ColumnVector& fx,
+                         real fstop = -DBL_MAX);
+  /**
+   * As above for npts points that are built on demand: point(j, x, data)
+   * stores point j (from 0) in x, a vector of size getDim() that is
+   * reused by the thread making the call.  point may be called
+   * concurrently for different j.
+   */
+  virtual int evalFBatch(int npts, OPTPP_POINTFCN point, void* data,
+                         NEWMAT::ColumnVector& fx, real fstop = -DBL_MAX);
+  /**
+   * Call the user-supplied objective at x without touching the cached
+   * state of the problem, so that several calls may run concurrently.
+   * @return false if the problem has no such evaluator
+   */
+  virtual bool evalFRaw(const NEWMAT::ColumnVector&, real&)
+    { return false;}
+
+  /// Account for n evaluations done through evalFRaw
+  void addFevals(int n) {nfevals += n; profileCount(OptppProfile::Fevals, n);}
+
+  /// Add n to counter c of the profile, if there is one
+  void profileCount(OptppProfile::Counter c, int n = 1)
+    { if (profile) profile->count(c, n);}
+
+  /// Set the number of threads used for batched function evaluations
+  void setNumThreads(int n) {nthreads = (n < 1) ? 1 : n;}
+  /**
+   * @return Number of threads used for batched function evaluations
+   */
+  int  getNumThreads() const {return nthreads;}
+
+  /// Record evaluation timers and counters in prof (0 turns them off)
+  void setProfile(OptppProfile* prof) 
+    {profile = prof; application.setProfile(prof);}
+  /**
+   * @return Profile receiving evaluation timers and counters, or 0
+   */
+  OptppProfile* getProfile() const {return profile;}
+
   // Constraint helper functions
   /**
    * @return Total number of constraints 
@@ -262,6 +317,7 @@ public:
 /// Destructor
   virtual ~NLP0() {;}        
 
+
 //------------------------------------------------------------------------
 // These are defined elsewhere
 //------------------------------------------------------------------------
@@ -81,6 +81,8 @@ public:
   * @return Number of gradient evaluations.
   */
   int getGevals()        const {return ngevals;}
+ /// Set the number of gradient evaluations, e.g. on a restart
+  void setGevals(int n) {ngevals = n;}
 
  /**
   * @return Is there analytic gradient information available?
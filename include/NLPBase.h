@@ -32,6 +32,7 @@ using std::ostream;
 #include "OptppArray.h"
 #include "OptppFatalError.h"
 #include "OptppExceptions.h"
+#include "OptppSparseMatrix.h"
 
 
 namespace OPTPP {
@@ -94,6 +95,9 @@ public:
 // Constraint Evaluation Methods
   virtual NEWMAT::ColumnVector evalCF(const NEWMAT::ColumnVector &x)  = 0;
   virtual NEWMAT::Matrix evalCG(const NEWMAT::ColumnVector &x)  = 0;
+  /// Sparse constraint gradient; by default the nonzeros of evalCG(x)
+  virtual OptppSparseMatrix evalCGSparse(const NEWMAT::ColumnVector &x)
+    { return OptppSparseMatrix(evalCG(x));}
   virtual NEWMAT::SymmetricMatrix evalCH(NEWMAT::ColumnVector &x)  = 0;
   virtual OptppArray<NEWMAT::SymmetricMatrix> evalCH(NEWMAT::ColumnVector &x, int darg)  = 0;
   virtual void evalC(const NEWMAT::ColumnVector &x)  = 0;
@@ -146,6 +146,7 @@ public:
   virtual NEWMAT::ColumnVector evalResidual(const NEWMAT::ColumnVector& xc) const ;
   virtual void evalCFGH(const NEWMAT::ColumnVector& xc) const ;
   virtual NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xc) const ;
+  virtual OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xc) const ;
   virtual NEWMAT::SymmetricMatrix evalHessian(NEWMAT::ColumnVector& xc) const ;
   virtual OptppArray<NEWMAT::SymmetricMatrix> evalHessian(NEWMAT::ColumnVector& xc, int darg) const ; 
   virtual bool amIFeasible(const NEWMAT::ColumnVector& xc, double epsilon) const;
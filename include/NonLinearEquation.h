@@ -79,6 +79,13 @@ public:
  */
   NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xc) const ;
 
+/**
+ * Takes one argument and returns a sparse matrix.
+ * @param xc a ColumnVector
+ * @return The gradient of the nonlinear equations evaluated at xc.
+ */
+  OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xc) const ;
+
 /**
  * Takes one argument and returns a SymmetricMatrix
  * @param xc a ColumnVector
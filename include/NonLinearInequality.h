@@ -91,6 +91,13 @@ public:
    */
   NEWMAT::Matrix evalGradient(const NEWMAT::ColumnVector& xc) const;
 
+  /**
+   * Takes one argument and returns a sparse matrix.
+   * @param xc a ColumnVector
+   * @return The gradient of the nonlinear inequalities evaluated at xc.
+   */
+  OptppSparseMatrix evalSparseGradient(const NEWMAT::ColumnVector& xc) const;
+
   /**
    * Takes one argument and returns a SymmetricMatrix.
    * @param xc a ColumnVector
@@ -17,8 +17,10 @@
 #include <fstream>
 #ifdef HAVE_STD
 #include <cstring>
+#include <ctime>
 #else
 #include <string.h>
+#include <time.h>
 #endif
 
 #include "globals.h"
@@ -29,6 +31,11 @@
 #include "NLP.h"
 #include "NLF.h"
 #include "TOLS.h"
+#include "OptppProfile.h"
+#include "OptppTrace.h"
+#include "OptppCheckpoint.h"
+#include "OptppAsyncBuf.h"
+#include "OptppFileBuf.h"
 
 using std::cerr;
 using std::cout;
@@ -68,7 +75,7 @@ int trustregion(NLP1*, ostream*, NEWMAT::SymmetricMatrix&, NEWMAT::ColumnVector&
 
 int trustpds(NLP1*, ostream*, NEWMAT::SymmetricMatrix&, NEWMAT::ColumnVector&, 
 		NEWMAT::ColumnVector&, real&, real&, real stpmax = 1.e3,
-		real stpmin = 1.e-9, int searchSize = 64);
+		real stpmin = 1.e-9, int searchSize = 64, bool* first = 0);
 
 int dogleg(NLP1*, ostream*, NEWMAT::SymmetricMatrix&, NEWMAT::ColumnVector&, NEWMAT::ColumnVector&,
            NEWMAT::ColumnVector&, real&, real&, real);
@@ -81,6 +88,10 @@ int linesearch(NLP1*, ostream*, NEWMAT::ColumnVector&, NEWMAT::ColumnVector&, re
  	       int itnmax = 5, real ftol = 1.e-4, real xtol = 2.2e-16, 
 	       real gtol = 0.9);
 
+int parlinesearch(NLP1*, ostream*, NEWMAT::ColumnVector&, NEWMAT::ColumnVector&,
+		  real *, real stpmax = 1.e3, real stpmin = 1.e-9,
+		  int itnmax = 5, real ftol = 1.e-4, real gtol = 0.9);
+
 int backtrack(NLP1*, ostream*, NEWMAT::ColumnVector&, NEWMAT::ColumnVector&, real *,
 	      int itnmax = 5, real ftol = 1.e-4, 
               real stpmax = 1.e3, real stpmin = 1.e-9);
@@ -152,11 +163,116 @@ protected:
   /// User defined function to call after each nonlinear iteration
   UPDATEFCN  update_fcn;  
 
-  filebuf file_buffer;
+  /// Output file buffer, opened when first written to
+  OptppFileBuf file_buffer;
   /// Output file 
   ostream *optout;
   /// Output file success
   int     optout_fd;
+  /// Optional per-phase timers and counters
+  OptppProfile *profile;
+  /// Optional binary iteration trace, replaces the text summaries
+  OptppTrace   *iter_trace;
+  /// Background writer between optout and its file, if enabled
+  OptppAsyncBuf *async_buf;
+  /// Output is discarded, see setNullOutput()
+  bool          null_output;
+  /// Optional test for stopping a run early, see setStopTest()
+  STOPFCN       stop_fcn;
+  void         *stop_data;
+  /// Checkpoint file and interval in iterations, see setCheckpoint()
+  std::string   ckpt_file;
+  int           ckpt_every;
+  /// File to resume the next runs from, see setRestart()
+  std::string   restart_file;
+
+/**
+ * Ask the stop test, if one is set, whether to end the run after
+ * iteration k at the point x with objective value f
+ */
+  bool stopRequested(int k, real f, const NEWMAT::ColumnVector& x)
+    { return stop_fcn != 0 && (*stop_fcn)(k, f, x, stop_data); }
+/**
+ * Save the state after iteration k to the checkpoint file if a
+ * checkpoint is due
+ */
+  void writeCheckpoint(int k) {
+    if (ckpt_every <= 0 || k % ckpt_every != 0) return;
+    OptppCheckpoint ck;
+    if (ck.open(ckpt_file.c_str(), method, dim)) {
+      ck.put(k);
+      putState(ck);
+      if (ck.commit()) return;
+    }
+    cerr << method << ": Can't write checkpoint " << ckpt_file << endl;
+  }
+/**
+ * @return true if the run is to resume from a checkpoint
+ */
+  bool restartRequested() const { return !restart_file.empty(); }
+/**
+ * Restore the state saved by writeCheckpoint() from the restart file
+ * and set k to the iteration it was saved after.  On failure the run
+ * ends with return code -17.
+ * @return false if the file is missing or incomplete, or was written
+ * by another method or for a problem of another dimension
+ */
+  bool readCheckpoint(int& k) {
+    OptppCheckpointReader ck;
+    int iter = 0;
+    if (ck.open(restart_file.c_str(), method, dim) && ck.get(iter)) {
+      getState(ck);
+      if (ck.close()) {
+	*optout << method << ": Restarted from " << restart_file
+		<< " after iteration " << iter << "\n";
+	k = iter;
+	return true;
+      }
+    }
+    cerr << method << ": Can't restart from " << restart_file << endl;
+    setMesg("Can't read the restart file");
+    ret_code = -17;
+    setReturnCode(ret_code);
+    return false;
+  }
+/**
+ * Write the part of the state kept by OptimizeClass.  Methods that
+ * support checkpoints add their own state and the state of their
+ * NLP, which must be read back in the same order by getState().
+ */
+  virtual void putState(OptppCheckpoint& ck) const {
+    ck.put(xprev); ck.put(fprev); ck.put(mem_step); ck.put(step_length);
+    ck.put(fcn_evals); ck.put(backtracks); ck.put(sx); ck.put(sfx);
+  }
+  virtual void getState(OptppCheckpointReader& ck) {
+    ck.get(xprev); ck.get(fprev); ck.get(mem_step); ck.get(step_length);
+    ck.get(fcn_evals); ck.get(backtracks); ck.get(sx); ck.get(sfx);
+  }
+/**
+ * Close the profile record of iteration k, if a profile is attached
+ */
+  void profileIteration(int k) { if (profile) profile->endIteration(k); }
+/**
+ * Add n to counter c of the profile, if one is attached
+ */
+  void profileCount(OptppProfile::Counter c, int n = 1)
+    { if (profile) profile->count(c, n); }
+/**
+ * Write the summary of iteration k to the binary trace, if one is
+ * selected.
+ * @return true if the iteration was traced or output is switched off;
+ * the caller then skips its text summary
+ */
+  bool traceIteration(int k, real f, real gnorm, real step, int step_type,
+		      int fevals, int gevals, const NEWMAT::ColumnVector& x)
+  {
+    if (iter_trace == 0) return null_output;
+    OptppTraceRecord r;
+    r.iter = k; r.f = f; r.gnorm = gnorm; r.step = step;
+    r.step_type = step_type; r.fevals = fevals; r.gevals = gevals;
+    iter_trace->write(r, x.Store());
+    return true;
+  }
 
 
 /**
@@ -207,6 +323,23 @@ protected:
      }
   }
 
+/**
+ * Write the current date and time into buf, which must hold at least
+ * 26 characters.  Unlike asctime(localtime()) this does not use a
+ * buffer shared by all threads.
+ */
+  static char* jobTime(char* buf)
+  {
+    time_t t = time(NULL);
+#ifdef _WIN32
+    strcpy(buf, asctime(localtime(&t)));  // per thread on Windows
+#else
+    struct tm tm;
+    asctime_r(localtime_r(&t, &tm), buf);
+#endif
+    return buf;
+  }
+
 public:
 /**
  * Default Constructor
@@ -214,13 +347,9 @@ public:
  * @see OptimizeClass(TOLS t)
  * @see OptimizeClass(int n, TOLS t)
  */
-  OptimizeClass(): x_optout_fd(-1), dim(0), debug_(0), trace(0) {
+  OptimizeClass(): x_optout_fd(-1), dim(0), debug_(0), trace(0), profile(0), iter_trace(0), async_buf(0), null_output(false), stop_fcn(0), stop_data(0), ckpt_every(0) {
     optout = new ostream(&file_buffer);
-    file_buffer.open("OPT_DEFAULT.out", std::ios::out);
-    if (!file_buffer.is_open() || !optout->good()) {
-      cout << "OptimizeClass:: Can't open default output file\n";
-      optout_fd = 0;
-    }
+    file_buffer.openLazy("OPT_DEFAULT.out");
     update_fcn = &opt_default_update_model;
     tol.setDefaultTol();
   }
@@ -229,13 +358,9 @@ public:
  * @param n an integer argument
  */
   OptimizeClass(int n): x_optout_fd(-1), dim(n), sx(n), sfx(n), xprev(n),
-    fcn_evals(0), backtracks(0), debug_(0), trace(0)      {
+    fcn_evals(0), backtracks(0), debug_(0), trace(0), profile(0), iter_trace(0), async_buf(0), null_output(false), stop_fcn(0), stop_data(0), ckpt_every(0)      {
     optout = new ostream(&file_buffer);
-    file_buffer.open("OPT_DEFAULT.out", std::ios::out);
-    if (!file_buffer.is_open() || !optout->good()) {
-      cout << "OptimizeClass:: Can't open default output file\n";
-      optout_fd = 0;
-    }
+    file_buffer.openLazy("OPT_DEFAULT.out");
     update_fcn = &opt_default_update_model;
     sx  = 1.0; sfx = 1.0; xprev = 0.0; 
     tol.setDefaultTol(); 
@@ -244,13 +369,9 @@ public:
 /**
  * @param t a TOLS object
  */
-  OptimizeClass(TOLS t): x_optout_fd(-1), dim(0), tol(t), debug_(0), trace(0){
+  OptimizeClass(TOLS t): x_optout_fd(-1), dim(0), tol(t), debug_(0), trace(0), profile(0), iter_trace(0), async_buf(0), null_output(false), stop_fcn(0), stop_data(0), ckpt_every(0){
     optout = new ostream(&file_buffer);
-    file_buffer.open("OPT_DEFAULT.out", std::ios::out);
-    if (!file_buffer.is_open() || !optout->good()) {
-      cout << "OptimizeClass:: Can't open default output file\n";
-      optout_fd = 0;
-    }
+    file_buffer.openLazy("OPT_DEFAULT.out");
     update_fcn = &opt_default_update_model;
     sx  = 1.0; sfx = 1.0; xprev = 0.0; 
   }
@@ -260,19 +381,18 @@ public:
  * @param t a TOLS object
  */
   OptimizeClass(int n, TOLS t): x_optout_fd(-1), dim(n), tol(t), sx(n),sfx(n),
-      xprev(n), fcn_evals(0), backtracks(0), debug_(0), trace(0){
+      xprev(n), fcn_evals(0), backtracks(0), debug_(0), trace(0), profile(0), iter_trace(0), async_buf(0), null_output(false), stop_fcn(0), stop_data(0), ckpt_every(0){
     optout = new ostream(&file_buffer);
-    file_buffer.open("OPT_DEFAULT.out", std::ios::out);
-    if (!file_buffer.is_open() || !optout->good()) {
-      cout << "OptimizeClass:: Can't open default output file\n";
-      optout_fd = 0;
-    }
+    file_buffer.openLazy("OPT_DEFAULT.out");
       update_fcn = &opt_default_update_model;
       sx  = 1.0; sfx = 1.0; xprev = 0.0;
     }
 
-  virtual ~OptimizeClass() { cleanup(); if (optout != NULL) delete optout;}
-  void  cleanup() {optout->flush();};
+  virtual ~OptimizeClass() { cleanup(); setSyncOutput();
+                             if (optout != NULL) delete optout;
+                             delete iter_trace;}
+  void  cleanup() {optout->flush(); if (async_buf) async_buf->drain();
+                   if (iter_trace) iter_trace->flush();};
 
 // set various properties
 
@@ -345,7 +465,10 @@ public:
   int setOutputFile(const char *filename, int append) { 
 
     if (x_optout_fd == -1) {  // Change the default output file
-      file_buffer.close();
+      if (async_buf) async_buf->drain();
+      file_buffer.closeAll();
+      optout->clear();
+      null_output = false;
       if (append)
          file_buffer.open(filename, std::ios::out|std::ios::app);
       else
@@ -378,7 +501,10 @@ public:
 
   int setOutputFile(ostream& fout) { 
 
-    optout->rdbuf(fout.rdbuf());
+    optout->clear();
+    null_output = false;
+    if (async_buf) async_buf->setTarget(fout.rdbuf());
+    else optout->rdbuf(fout.rdbuf());
     if (!optout->good()) {
       cout << "OptimizeClass::setOutputFile: Can't open file." << endl;
       optout_fd = 0;
@@ -389,6 +515,117 @@ public:
     return optout_fd;
   }
 
+/**
+ * Discard all output.  The output stream is put into a failed state,
+ * so text written to it is neither formatted nor stored, and the
+ * optimizers skip their per-iteration summaries altogether.  Any
+ * output file is closed; setOutputFile() turns output on again.
+ */
+  void setNullOutput() {
+    optout->flush();
+    if (async_buf) async_buf->drain();
+    file_buffer.closeAll();
+    optout->setstate(std::ios::badbit);
+    null_output = true;
+  }
+/**
+ * @return true if output is switched off with setNullOutput()
+ */
+  bool isNullOutput() const {return null_output;}
+
+/**
+ * Call fcn(k, f, x, data) after every iteration k; when it returns
+ * true the optimizer stops with return code -16.  Used to cancel runs
+ * from another thread, e.g. by OptMultiStart.
+ */
+  void setStopTest(STOPFCN fcn, void* data = 0)
+    { stop_fcn = fcn; stop_data = data;}
+
+/**
+ * Save the state of the run to filename after every every-th
+ * iteration, so that setRestart() can continue it after a crash.
+ * The file is replaced only once the new checkpoint is complete.
+ * An empty filename or every < 1 switches checkpoints off.
+ * Supported by the Newton-like methods of OptNewtonLike (OptQNewton,
+ * OptNewton, OptFDNewton), by the synchronous OptGSS and by OptPDS.
+ */
+  void setCheckpoint(const char* filename, int every = 1)
+    { ckpt_file = filename? filename : "";
+      ckpt_every = ckpt_file.empty()? 0 : every;}
+/**
+ * Resume the next runs from the checkpoint filename instead of the
+ * initial point.  The problem and the options must be set up as for
+ * the run that wrote the checkpoint; the resumed run then repeats
+ * the remaining iterations of that run exactly.  An empty filename
+ * starts from the initial point again.
+ */
+  void setRestart(const char* filename)
+    { restart_file = filename? filename : "";}
+
+/**
+ * Write the output file from a background thread.  Text written to
+ * the output stream goes through a ring buffer of capacity bytes;
+ * when that is full the optimizer waits (OptppAsyncBuf::Block) or the
+ * text is discarded (OptppAsyncBuf::Drop).  cleanup() waits until
+ * all text has been written.
+ */
+  void setAsyncOutput(unsigned long capacity = 1 << 20,
+		      OptppAsyncBuf::Policy policy = OptppAsyncBuf::Block) {
+    if (async_buf != 0) return;
+    async_buf = new OptppAsyncBuf(optout->rdbuf(), capacity, policy);
+    optout->rdbuf(async_buf);
+  }
+/**
+ * Write the output file from the optimizer thread again
+ */
+  void setSyncOutput() {
+    if (async_buf == 0) return;
+    optout->flush();
+    async_buf->drain();
+    optout->rdbuf(async_buf->getTarget());
+    delete async_buf;
+    async_buf = 0;
+  }
+/**
+ * @return Number of output characters discarded by the background
+ * writer
+ */
+  unsigned long getDroppedOutput() const
+    { return async_buf? async_buf->getDropped() : 0;}
+
+/**
+ * Write the per-iteration summaries to the binary trace file filename
+ * (see OptppTrace.h) instead of the output file; withX also stores
+ * every iterate.  The header and final status are still written to
+ * the output file.  The opttrace tool prints a trace as text.
+ * @return 1 on success, 0 if the file cannot be created
+ */
+  int setTraceFile(const char *filename, bool withX = false) {
+    if (iter_trace == 0) iter_trace = new OptppTrace;
+    if (!iter_trace->open(filename, dim, withX)) {
+      cout << "OptimizeClass::setTraceFile: Can't open " << filename << endl;
+      delete iter_trace;
+      iter_trace = 0;
+      return 0;
+    }
+    return 1;
+  }
+/**
+ * Close the binary trace; summaries go to the output file again
+ */
+  void closeTraceFile() { delete iter_trace; iter_trace = 0;}
+
+/**
+ * Record per-phase timers and counters of the following runs in prof;
+ * 0 turns profiling off.  Optimizers working on an NLP pass the
+ * profile on to it.
+ */
+  virtual void setProfile(OptppProfile* prof) {profile = prof;}
+/**
+ * @return Attached profile, or 0
+ */
+  OptppProfile* getProfile() const {return profile;}
+
  /// Set debug flag to true
   void setDebug()         {debug_ = true;}   
 /**
@@ -41,6 +41,7 @@ protected:
   real TR_size;				///< Trust region radius
   real gradMult;			///< Gradient multiplier to compute TR_size
   int searchSize;               	///< Search pattern size for TRPDS
+  bool firstPDSStep;            ///< No TRPDS step accepted yet
   int m_nconvgd;			///< Syncs fcn & constraint convergence
   bool WarmStart;
 
@@ -65,7 +66,7 @@ public:
   OptBCNewtonLike(int n): 
     OptimizeClass(n), gprev(n), Hessian(n), grad_evals(0),
     strategy(LineSearch), finitediff(ForwardDiff), TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false){;}
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false){;}
 /**
  * @param n an integer argument
  * @param u a function pointer.
@@ -75,7 +76,7 @@ public:
   OptBCNewtonLike(int n, UPDATEFCN u): 
     OptimizeClass(n), gprev(n), Hessian(n),grad_evals(0),
     strategy(LineSearch), finitediff(ForwardDiff),TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false)
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false)
       {update_fcn = u;}
 /**
  * @param n an integer argument
@@ -86,7 +87,7 @@ public:
   OptBCNewtonLike(int n, TOLS t): 
     OptimizeClass(n,t), gprev(n), Hessian(n), grad_evals(0),
     strategy(LineSearch), finitediff(ForwardDiff),TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false){;}
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false){;}
   
 /**
  * Destructor 
@@ -199,12 +200,18 @@ public:
   void setSearchSize(int sss) {searchSize = sss;}
 
   bool getWarmStart() const {return WarmStart;}
-  void useWarmStart(NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+  /// Start the next optimization from H, e.g. getHessian() of a related solve
+  void UseWarmStart(const NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+  void useWarmStart(const NEWMAT::SymmetricMatrix& H) {UseWarmStart(H);}
 
   /**
    * @return Globalization strategy for optimization algorithm 
    */
   SearchStrategy getSearchStrategy() const {return strategy;}
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlprob()->setProfile(prof);}
+
   /// Set globalization strategy for optimization algorithms
   void setSearchStrategy(SearchStrategy s) {strategy = s;}
 
@@ -221,7 +228,7 @@ public:
 
   friend int trustpds(NLP1*, ostream*, NEWMAT::SymmetricMatrix&,
 		      NEWMAT::ColumnVector&, NEWMAT::ColumnVector&,
-		      real&, real&, real stpmax, real stpmin, int);
+		      real&, real&, real stpmax, real stpmin, int, bool*);
 };
 
 /**
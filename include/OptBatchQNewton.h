@@ -0,0 +1,158 @@
+#ifndef OptBatchQNewton_h
+#define OptBatchQNewton_h
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include <iostream>
+
+#include "globals.h"
+#include "TOLS.h"
+#include "OptppThreads.h"
+
+namespace OPTPP {
+
+/**
+ * Objective function and gradient of a batch of problems.
+ *
+ * The points of m problems are passed together; idx[j] is the number
+ * of the j-th problem and its variables are x[i*m + j], i = 0,...,n-1.
+ * The function sets fx[j] and, for NLPGradient, gx[i*m + j].  A
+ * non-finite fx[j] marks a point where the function cannot be
+ * evaluated.
+ *
+ * Arguments: mode, n, m, idx, x, fx, gx, result, data
+ */
+typedef void (*USERFCN1B)(int, int, int, const int*, const double*,
+			  double*, double*, int&, void*);
+
+/**
+ * Residuals and Jacobian of a batch of least squares problems, laid
+ * out as in USERFCN1B: residual r of problem idx[j] is fvec[r*m + j],
+ * its derivative with respect to variable i is fjac[(r*n + i)*m + j].
+ *
+ * Arguments: mode, n, nres, m, idx, x, fvec, fjac, result, data
+ */
+typedef void (*USERFCNLSQ1B)(int, int, int, int, const int*, const double*,
+			     double*, double*, int&, void*);
+
+/**
+ * OptBatchQNewton solves many small unconstrained problems of the same
+ * dimension at once.  Each problem is minimized with a quasi-Newton
+ * (BFGS) method, or with Gauss-Newton for least squares problems,
+ * globalized by a backtracking line search.  The iterations of the
+ * problems are independent, but they are carried out in lock step.
+ *
+ * All state is kept structure-of-arrays: component i of problem k is
+ * stored at i*nprob + k.  The inner loops of the Cholesky solves, the
+ * BFGS updates and the line search run over problems, so the compiler
+ * can vectorize them, and the user function is called once per
+ * iteration for all problems still running.
+ *
+ * The problems are processed in blocks (setBlockSize()), which may run
+ * on several threads (setNumThreads()); the user function must then be
+ * safe to call concurrently.  Within a block, the problems that have
+ * converged no longer call the user function.
+ *
+ * The convergence tests and return codes follow OptNewtonLike: 1 to 4
+ * for the step, function and gradient tests, -1 if the line search
+ * fails, -2 if the function cannot be evaluated at the starting
+ * point, and -4 if the iteration or evaluation limit is reached.
+ * Nothing is written to an output file.
+ */
+class OptBatchQNewton {
+  int           n;              ///< Number of variables per problem
+  int           nprob;          ///< Number of problems
+  int           nres;           ///< Residuals per problem, 0 for BFGS
+  USERFCN1B     fcn;
+  USERFCNLSQ1B  lsqfcn;
+  void*         data;
+
+  TOLS          tol;
+  int           block;
+  int           nthreads;
+
+  double *x, *f, *g;            ///< Current iterates
+  double *H;                    ///< Packed lower triangle of the Hessian
+  int    *ret, *iters, *fevals;
+  long   ncalls;
+  OptppMutex mutex;
+
+  void allocate();
+  void evaluate(int mode, int m, const int* idx, const double* xb,
+		double* fb, double* gb, double* hb, double* work);
+  void solveBlock(int b0, int b1);
+
+  static int runBlock(int i, void* self);
+
+  OptBatchQNewton(const OptBatchQNewton&);
+  OptBatchQNewton& operator=(const OptBatchQNewton&);
+
+public:
+  /**
+   * @param ndim Number of variables of each problem
+   * @param np Number of problems
+   * @param u Objective function and gradient
+   * @param d Passed on to u
+   */
+  OptBatchQNewton(int ndim, int np, USERFCN1B u, void* d = 0);
+  /**
+   * Least squares problems, minimizing the sum of squared residuals
+   * @param ndim Number of variables of each problem
+   * @param nr Number of residuals of each problem
+   * @param np Number of problems
+   * @param u Residuals and Jacobian
+   * @param d Passed on to u
+   */
+  OptBatchQNewton(int ndim, int nr, int np, USERFCNLSQ1B u, void* d = 0);
+  ~OptBatchQNewton();
+
+  /// Starting points, x0[i*np + k] is variable i of problem k
+  void setX(const double* x0);
+  /// Starting point of problem k
+  void setX(int k, const NEWMAT::ColumnVector& x0);
+
+  void setMaxStep(double s)     { tol.setMaxStep(s);}
+  void setMinStep(double s)     { tol.setMinStep(s);}
+  void setStepTol(double s)     { tol.setStepTol(s);}
+  void setFcnTol(double s)      { tol.setFTol(s);}
+  void setGradTol(double s)     { tol.setGTol(s);}
+  void setLineSearchTol(double s) { tol.setLSTol(s);}
+  void setMaxIter(int k)        { tol.setMaxIter(k);}
+  void setMaxBacktrackIter(int k) { tol.setMaxBacktrackIter(k);}
+  void setMaxFeval(int k)       { tol.setMaxFeval(k);}
+
+  /// Problems solved together (default 256)
+  void setBlockSize(int b)      { block = b;}
+  /// Threads working on separate blocks (default 1)
+  void setNumThreads(int t)     { nthreads = t;}
+
+  /// Minimize all problems
+  void optimize();
+
+  int getNumProblems() const    { return nprob;}
+  /// Solutions, laid out as in setX()
+  const double* getX() const    { return x;}
+  NEWMAT::ColumnVector getX(int k) const;
+  double getF(int k) const      { return f[k];}
+  int getReturnCode(int k) const { return ret[k];}
+  int getIter(int k) const      { return iters[k];}
+  int getFevals(int k) const    { return fevals[k];}
+  /// Number of problems with a positive return code
+  int getNumConverged() const;
+  /// Number of calls of the user function
+  long getNumCalls() const      { return ncalls;}
+
+  void printStatus(std::ostream& out) const;
+};
+
+} // namespace OPTPP
+
+#endif
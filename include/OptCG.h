@@ -58,7 +58,15 @@ class OptCGLike: public OptimizeClass {
    */
   virtual ~OptCGLike(){}
 
-  /// Set the user-specified globalization strategy
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlprob()->setProfile(prof);}
+
+  /**
+   * Set the user-specified globalization strategy: LineSearch or
+   * ParallelLineSearch, which evaluates a ladder of trial steps as
+   * one batch.
+   */
   void setSearchStrategy(SearchStrategy s) {strategy = s;}
 
    /**
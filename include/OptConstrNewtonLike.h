@@ -7,6 +7,7 @@
  -----------------------------------------------------------------------*/
 
 #include "Opt.h"
+#include "OptppSparseMatrix.h"
 
 using std::ostream;
 
@@ -42,8 +43,8 @@ protected:
   NEWMAT::ColumnVector constraintResidual; ///< Constraint residual at xc
   NEWMAT::ColumnVector gradl;		///< Current gradient of the lagrangian
   NEWMAT::ColumnVector gradlprev;	///< Previous gradient of the lagrangian
-  NEWMAT::Matrix constraintGradient;	///< Current constraint gradient 
-  NEWMAT::Matrix constraintGradientPrev; ///< Previous constraint gradient
+  OptppSparseMatrix constraintGradient;	///< Current constraint gradient 
+  OptppSparseMatrix constraintGradientPrev; ///< Previous constraint gradient
   NEWMAT::SymmetricMatrix Hessian;	///< Current Hessian
   NEWMAT::SymmetricMatrix hessl;	///< Current Hessian of the lagrangian
   SearchStrategy strategy;	///< User-specified globalization strategy
@@ -52,6 +53,7 @@ protected:
   real TR_size;			///< Size of the trust region radius 
   real gradMult;		///< Gradient multiplier to compute TR_size
   int searchSize;               ///< Search pattern size for TRPDS
+  bool firstPDSStep;            ///< No TRPDS step accepted yet
   real cost;			///< Value of the merit function
   void defaultAcceptStep(int, int);
   NEWMAT::ColumnVector defaultComputeSearch(NEWMAT::SymmetricMatrix& );
@@ -79,7 +81,7 @@ public:
     gradl(n), gradlprev(n),constraintGradient(n,n), constraintGradientPrev(n,n),
     Hessian(n), hessl(n), strategy(TrustRegion), finitediff(ForwardDiff), 
     mfcn(ArgaezTapia), TR_size(0.0), 
-    gradMult(0.1), searchSize(64), cost(0.0), WarmStart(false),
+    gradMult(0.1), searchSize(64), firstPDSStep(true), cost(0.0), WarmStart(false),
     feas_flag(false), max_feas_iter(3)
     {z = 0; y = 0; s = 0;}
  /**
@@ -94,7 +96,7 @@ public:
     gradl(n), gradlprev(n),constraintGradient(n,n), constraintGradientPrev(n,n),
     Hessian(n), hessl(n), strategy(TrustRegion), finitediff(ForwardDiff), 
     mfcn(ArgaezTapia), TR_size(0.0), 
-    gradMult(0.1), searchSize(64), cost(0.0), WarmStart(false),
+    gradMult(0.1), searchSize(64), firstPDSStep(true), cost(0.0), WarmStart(false),
     feas_flag(false), max_feas_iter(3)
     {update_fcn = u; z = 0; y = 0; s = 0;}
  /**
@@ -109,7 +111,7 @@ public:
     gradl(n), gradlprev(n),constraintGradient(n,n), constraintGradientPrev(n,n),
     Hessian(n), hessl(n), strategy(TrustRegion), finitediff(ForwardDiff), 
     mfcn(ArgaezTapia), TR_size(0.0), 
-    gradMult(0.1), searchSize(64), cost(0.0), WarmStart(false),
+    gradMult(0.1), searchSize(64), firstPDSStep(true), cost(0.0), WarmStart(false),
     feas_flag(false), max_feas_iter(3)
     {z = 0; y = 0; s = 0;}
   
@@ -203,7 +205,12 @@ public:
   void setSearchSize(int sss) {searchSize = sss;}
 
   bool getWarmStart() const {return WarmStart;}
-  void UseWarmStart(NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+  /// Start the next optimization from H, e.g. getHessian() of a related solve
+  void UseWarmStart(const NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlprob()->setProfile(prof);}
 
   /**
    * @return Globalization strategy for optimization algorithm 
@@ -272,9 +279,19 @@ public:
   /**
    * @return Gradient of the constraints at the current iteration 
    */
-  NEWMAT::Matrix getConstraintGradient() const  { return constraintGradient;}
+  NEWMAT::Matrix getConstraintGradient() const  
+                       { return constraintGradient.toDense();}
+  /**
+   * @return Gradient of the constraints at the current iteration,
+   * without a dense copy
+   */
+  const OptppSparseMatrix& getSparseConstraintGradient() const  
+                       { return constraintGradient;}
   /// Store the current gradients of the constraints 
   virtual void setConstraintGradient(const NEWMAT::Matrix& constraint_grad) 
+                       { constraintGradient = OptppSparseMatrix(constraint_grad);}
+  /// Store the current gradients of the constraints 
+  virtual void setConstraintGradient(const OptppSparseMatrix& constraint_grad) 
                        { constraintGradient = constraint_grad;}
 
   /**
@@ -330,7 +347,7 @@ public:
 
   friend int trustpds(NLP1*, ostream*, NEWMAT::SymmetricMatrix&,
 		      NEWMAT::ColumnVector&, NEWMAT::ColumnVector&,
-		      real&, real&, real stpmax, real stpmin, int);
+		      real&, real&, real stpmax, real stpmin, int, bool*);
 };
 
 /**
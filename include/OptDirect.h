@@ -9,6 +9,13 @@
 
 namespace OPTPP{
 
+/**
+ * OptDirect is a derived class of OptimizeClass and the base class for direct
+ * search methods.  In OPT++, OptGA, a genetic algorithm, OptPDS,
+ * a parallel direct search method, and OptGSS, a generating set search,
+ * are examples of direct search methods.
+ */
+
 class OptDirect: public OptimizeClass {
 
  public:
@@ -16,16 +23,13 @@ class OptDirect: public OptimizeClass {
   OptDirect(int n): OptimizeClass(n){}
   OptDirect(int n, TOLS t): OptimizeClass(n,t){}
   virtual ~OptDirect(){}
-
-  /* these are virtual in Optimizeclass
-
   virtual void acceptStep(int, int) = 0;
+  virtual void updateModel(int, int, NEWMAT::ColumnVector) = 0;
+
   virtual int checkConvg() {return 0;}
   virtual void optimize() {}
   virtual void readOptInput() {}
-  virtual void printStatus(char *) {}
-  virtual void updateModel(int, int, NEWMAT::ColumnVector) = 0;
-  */
+  virtual void reset() {}
 };
 
 } // namespace OPTPP
@@ -0,0 +1,273 @@
+#ifndef OptFixedNewton_h
+#define OptFixedNewton_h
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#include <iostream>
+
+#include "globals.h"
+#include "TOLS.h"
+#include "OptppFixed.h"
+
+namespace OPTPP {
+
+/**
+ * FixedNLF is a problem with N variables, N fixed at compile time.
+ * It holds the current point, function value, gradient and, if the
+ * user function provides it, the Hessian, all in fixed-size storage.
+ */
+template<int N> class FixedNLF {
+public:
+  /// Function and gradient: mode, x, fx, gx, result, data
+  typedef void (*USERFCN1)(int, const FixedVector<N>&, double&,
+			   FixedVector<N>&, int&, void*);
+  /// Function, gradient and Hessian: mode, x, fx, gx, Hx, result, data
+  typedef void (*USERFCN2)(int, const FixedVector<N>&, double&,
+			   FixedVector<N>&, FixedSymMatrix<N>&, int&, void*);
+
+private:
+  USERFCN1          fcn1;
+  USERFCN2          fcn2;
+  void*             data;
+  FixedVector<N>    xc;
+  double            fvalue;
+  FixedVector<N>    grad;
+  FixedSymMatrix<N> hess;
+  int               nfevals;
+
+public:
+  FixedNLF(USERFCN1 u, void* d = 0):
+    fcn1(u), fcn2(0), data(d), xc(0.0), fvalue(0.0), grad(0.0), nfevals(0)
+    { hess = 0.0;}
+  FixedNLF(USERFCN2 u, void* d = 0):
+    fcn1(0), fcn2(u), data(d), xc(0.0), fvalue(0.0), grad(0.0), nfevals(0)
+    { hess = 0.0;}
+
+  int  getDim() const         { return N;}
+  bool hasHessian() const     { return fcn2 != 0;}
+
+  void setX(const FixedVector<N>& x) { xc = x;}
+  const FixedVector<N>&    getXc() const   { return xc;}
+  double                   getF() const    { return fvalue;}
+  const FixedVector<N>&    getGrad() const { return grad;}
+  const FixedSymMatrix<N>& getHess() const { return hess;}
+  int  getFevals() const      { return nfevals;}
+  void reset()                { nfevals = 0;}
+
+  /// Evaluate at x without changing the current point
+  void evalAt(const FixedVector<N>& x, double& fx, FixedVector<N>& gx,
+	      FixedSymMatrix<N>& Hx)
+    {
+      int result = NLPNoOp;
+      if (fcn2)
+	(*fcn2)(NLPFunction | NLPGradient | NLPHessian, x, fx, gx, Hx,
+		result, data);
+      else
+	(*fcn1)(NLPFunction | NLPGradient, x, fx, gx, result, data);
+      nfevals++;
+    }
+
+  /// Make x the current point
+  void accept(const FixedVector<N>& x, double fx, const FixedVector<N>& gx,
+	      const FixedSymMatrix<N>& Hx)
+    { xc = x; fvalue = fx; grad = gx; if (fcn2) hess = Hx;}
+};
+
+/**
+ * OptFixedNewton minimizes a FixedNLF<N> with a Newton method when the
+ * problem supplies a Hessian, and with BFGS otherwise.  The search
+ * direction comes from the perturbed Cholesky factorization of
+ * MCholesky(); the step from a backtracking line search.  All vectors
+ * and matrices are fixed-size objects on the stack, so a solve does
+ * no heap allocation and writes no output.
+ *
+ * Tolerances are set as in OptimizeClass.  The convergence tests and
+ * return codes are those of OptNewtonLike: 1 to 4 for the step,
+ * function and gradient tests, -1 if the line search fails and -4 if
+ * the iteration or evaluation limit is reached.
+ */
+template<int N> class OptFixedNewton {
+  FixedNLF<N>* nlp;
+  TOLS         tol;
+  int          ret_code;
+  int          iter_taken;
+
+  int checkConvg(double snorm, double fprev) const;
+  void initHessian(FixedSymMatrix<N>& H) const;
+  void updateH(FixedSymMatrix<N>& H, const FixedVector<N>& s,
+	       const FixedVector<N>& y) const;
+
+public:
+  OptFixedNewton(FixedNLF<N>* p): nlp(p), ret_code(0), iter_taken(0)
+    { tol.setDefaultTol();}
+
+  void setMaxStep(double s)     { tol.setMaxStep(s);}
+  void setMinStep(double s)     { tol.setMinStep(s);}
+  void setStepTol(double s)     { tol.setStepTol(s);}
+  void setFcnTol(double s)      { tol.setFTol(s);}
+  void setGradTol(double s)     { tol.setGTol(s);}
+  void setLineSearchTol(double s) { tol.setLSTol(s);}
+  void setMaxIter(int k)        { tol.setMaxIter(k);}
+  void setMaxBacktrackIter(int k) { tol.setMaxBacktrackIter(k);}
+  void setMaxFeval(int k)       { tol.setMaxFeval(k);}
+
+  void optimize();
+
+  int getReturnCode() const     { return ret_code;}
+  int getIter() const           { return iter_taken;}
+
+  void printStatus(std::ostream& out) const
+    {
+      out << "\n**** OptFixedNewton (" << N << " variables, "
+	  << (nlp->hasHessian()? "Newton" : "BFGS") << ")\n"
+	  << "Return code       = " << ret_code << "\n"
+	  << "Iterations        = " << iter_taken << "\n"
+	  << "Function evals    = " << nlp->getFevals() << "\n"
+	  << "f(x)              = " << nlp->getF() << "\n"
+	  << "x                 =";
+      for (int i = 1; i <= N; i++) out << " " << nlp->getXc()(i);
+      out << "\n";
+    }
+};
+
+// Tests of OptNewtonLike::checkConvg
+
+template<int N>
+int OptFixedNewton<N>::checkConvg(double snorm, double fprev) const
+{
+  double xnorm = Norm2(nlp->getXc());
+  double f     = nlp->getF();
+  double gnorm = Norm2(nlp->getGrad());
+
+  if (snorm <= tol.getStepTol()*max(1.0, xnorm)) return 1;
+  if (fprev - f <= tol.getFTol()*max(1.0, fabs(f))) return 2;
+  if (gnorm <= tol.getGTol()*max(1.0, fabs(f))) return 3;
+  if (gnorm <= tol.getGTol()) return 4;
+  return 0;
+}
+
+// Diagonal starting matrix of OptQNewton::updateH
+
+template<int N>
+void OptFixedNewton<N>::initHessian(FixedSymMatrix<N>& H) const
+{
+  double typx = NormInfinity(nlp->getXc());
+  double gnorm = Norm2(nlp->getGrad());
+  if (typx == 0.0) typx = 1.0;
+  H.setDiagonal((gnorm != 0.0)? gnorm/typx : 1.0);
+}
+
+// BFGS update, skipped as in OptQNewton::updateH
+
+template<int N>
+void OptFixedNewton<N>::updateH(FixedSymMatrix<N>& H,
+				const FixedVector<N>& s,
+				const FixedVector<N>& y) const
+{
+  const double sqrteps = sqrt(DBL_EPSILON);
+  FixedVector<N> Bs;
+  int i, j;
+
+  double yts = Dot(y, s), snorm = Norm2(s), ynorm = Norm2(y);
+  if (yts <= sqrteps*snorm*ynorm) return;
+
+  multiply(H, s, Bs);
+  double sBs = Dot(s, Bs);
+  if (sBs <= 1.e-8*snorm*snorm) return;
+
+  for (i = 1; i <= N; i++)
+    for (j = 1; j <= i; j++)
+      H(i,j) += y(i)*y(j)/yts - Bs(i)*Bs(j)/sBs;
+}
+
+template<int N>
+void OptFixedNewton<N>::optimize()
+{
+  const int maxback = tol.getMaxBacktrackIter();
+  FixedVector<N> x, g, p, xt, gt, s, y;
+  FixedSymMatrix<N> H, Ht, Hf;
+  FixedLowerMatrix<N> L;
+  double f, ft, fprev, gtp, alpha, pnorm;
+  int bt;
+
+  ret_code   = 0;
+  iter_taken = 0;
+
+  x = nlp->getXc();
+  nlp->evalAt(x, f, g, H);
+  nlp->accept(x, f, g, H);
+
+  if (!nlp->hasHessian()) initHessian(H);
+
+  double gnorm = Norm2(g);
+  if (gnorm <= tol.getGTol()*max(1.0, fabs(f))) ret_code = 3;
+  else if (gnorm <= tol.getGTol()) ret_code = 4;
+
+  while (ret_code == 0) {
+
+    // Search direction from the perturbed Cholesky factor
+
+    Hf = H;
+    MCholesky(Hf, L);
+    p = g;
+    p *= -1.0;
+    cholSolve(L, p, p);
+
+    pnorm = Norm2(p);
+    if (pnorm > tol.getMaxStep()) {
+      p *= tol.getMaxStep()/pnorm;
+      pnorm = tol.getMaxStep();
+    }
+    gtp = Dot(g, p);
+
+    // Backtracking with safeguarded quadratic interpolation
+
+    alpha = 1.0;
+    for (bt = 0; ; bt++) {
+      xt = x;
+      xt.axpy(alpha, p);
+      nlp->evalAt(xt, ft, gt, Ht);
+      if (ft == ft && ft <= f + tol.getLSTol()*alpha*gtp) break;
+
+      double anew = 0.1*alpha;
+      if (ft == ft && fabs(ft) <= DBL_MAX) {
+	double denom = 2.0*(ft - f - gtp*alpha);
+	if (denom > 0.0) anew = -gtp*alpha*alpha/denom;
+      }
+      alpha = (anew < 0.1*alpha)? 0.1*alpha
+	: (anew > 0.5*alpha)? 0.5*alpha : anew;
+      if (bt == maxback || alpha*pnorm < tol.getMinStep()) {
+	ret_code = -1;
+	break;
+      }
+    }
+    if (ret_code != 0) break;
+
+    s = xt;
+    s -= x;
+    y = gt;
+    y -= g;
+    fprev = f;
+    x = xt;
+    f = ft;
+    g = gt;
+    nlp->accept(x, f, g, Ht);
+    iter_taken++;
+
+    if (nlp->hasHessian()) H = Ht;
+    else updateH(H, s, y);
+
+    ret_code = checkConvg(Norm2(s), fprev);
+    if (ret_code == 0 && (iter_taken >= tol.getMaxIter()
+			  || nlp->getFevals() >= tol.getMaxFeval()))
+      ret_code = -4;
+  }
+}
+
+} // namespace OPTPP
+
+#endif
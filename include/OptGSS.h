@@ -27,6 +27,8 @@ using std::cerr;
 
 namespace OPTPP {
 
+struct GSSAsyncState;
+
 class OptGSS : public OptDirect {
 
 protected:
@@ -65,7 +67,12 @@ protected:
   ///< Upper limit on the number of iterations
 
   bool SearchAll;
-  ///< search type flag (true ==> search on all direction) -- now defunct
+  ///< search type flag (true ==> search on all directions,
+  ///< false ==> opportunistic poll that stops at the first improvement)
+
+  bool Async;
+  ///< asynchronous search flag (true ==> APPS-style search with 
+  ///< one step length per direction, see optimizeAsync)
 
   bool computeGrad;
   ///< flag to compute gradient after 1st iteration. Used by trustGSS.
@@ -91,6 +98,11 @@ protected:
   bool printGiter;
   ///< flag for printing (up to 3) components of gX during iterations
 
+  void putState(OptppCheckpoint& ck) const;
+  ///< Saves the state of the synchronous search for a restart
+  void getState(OptppCheckpointReader& ck);
+  ///< Restores the state saved by putState()
+
   int mpi_rank; // also used in serial code
 
 #ifdef WITH_MPI
@@ -242,10 +254,21 @@ public:
   void setMaxIter(int s) { Iter_max = s;}
 
   /**
-   * Let the user set the search strategy
+   * Let the user set the search strategy.  With s = false the poll
+   * is opportunistic.  The trial points are evaluated concurrently
+   * when the NLP has more than one thread (see NLP0::setNumThreads).
    */
   void setFullSearch(bool s) { SearchAll = s;}
 
+  /**
+   * Let the user select the asynchronous (APPS-style) search.  Its
+   * evaluations are limited by setMaxFeval(); an iteration is a step
+   * that improves on the current point.  An NLP without a thread-safe
+   * evaluator (see NLP0::evalFRaw) has its evaluations serialized, with
+   * a warning.
+   */
+  void setAsync(bool s) { Async = s;}
+
   bool extras_searched() { return extras_srched; }
 
   void setPrintX(bool s) {printXiter = s;}
@@ -254,6 +277,14 @@ public:
 
   void setComputeGrad(bool s) {computeGrad = s;}
 
+  /**
+   * Attach a profile to the search and its NLP.  An iteration record
+   * is closed after every iteration, or after every improvement of
+   * the asynchronous search.
+   */
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); if (nlp) nlp->setProfile(prof);}
+
 
   //--
   // Our internal Optimization methods
@@ -287,6 +318,20 @@ public:
    * Search for improved point; 
    */
   int search();
+
+  /**
+   * Asynchronous parallel pattern search; called by optimize()
+   * when the asynchronous search has been selected.
+   */
+  void optimizeAsync();
+  void asyncWorker(GSSAsyncState* st);
+
+  /**
+   * Stores trial point i of search() in y: X + Delta * Act_i for the
+   * active directions, the extra search directions after them
+   */
+  void trialPoint(int i, NEWMAT::ColumnVector& y);
+  static void searchPoint(int j, NEWMAT::ColumnVector& x, void* v);
   //  int search(bool flag=false);
   //  int searchExtras() { return search(true);  }
   //  int searchGenSet() { return search(false); }
@@ -55,7 +55,15 @@ class OptLBFGSLike: public OptimizeClass {
    */
   virtual ~OptLBFGSLike(){}
 
-  /// Set the user-specified globalization strategy
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlprob()->setProfile(prof);}
+
+  /**
+   * Set the user-specified globalization strategy: LineSearch or
+   * ParallelLineSearch, which evaluates a ladder of trial steps as
+   * one batch.
+   */
   void setSearchStrategy(SearchStrategy s) {strategy = s;}
 
    /**
@@ -104,6 +112,15 @@ private:
 
   bool printXs; ///< controls if final point is printed by printStatus()
 
+  OptppArray<NEWMAT::ColumnVector> seed_s;  ///< steps to start from, oldest first
+  OptppArray<NEWMAT::ColumnVector> seed_y;  ///< gradient changes to start from
+  OptppArray<NEWMAT::ColumnVector> hist_s;  ///< steps kept at the end of optimize()
+  OptppArray<NEWMAT::ColumnVector> hist_y;  ///< gradient changes kept at the end
+
+  /// Copy the count pairs before position point of the circular memory
+  void saveHistory(const NEWMAT::ColumnVector* s, const NEWMAT::ColumnVector* y,
+		   int point, int count);
+
 protected:
   /**
    * @return Pointer to an NLP1 object
@@ -183,6 +200,19 @@ public:
 
   void setPrintFinalX(bool b) { printXs = b;}
 
+  /**
+   * Start the next optimization from the pairs s[i], y[i], oldest
+   * first, e.g. those returned by getHistory() after a related solve.
+   * Only the last m pairs with positive curvature y'*s are used.
+   */
+  void UseWarmStart(const OptppArray<NEWMAT::ColumnVector>& s,
+		    const OptppArray<NEWMAT::ColumnVector>& y);
+  bool getWarmStart() const { return seed_s.length() > 0;}
+  /// The pairs in memory when optimize() returned, oldest first
+  void getHistory(OptppArray<NEWMAT::ColumnVector>& s,
+		  OptppArray<NEWMAT::ColumnVector>& y) const
+    { s = hist_s; y = hist_y;}
+
   //--
   // Defined in OptLBFGS.C:
   //--
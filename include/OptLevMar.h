@@ -0,0 +1,124 @@
+#ifndef OptLevMar_h
+#define OptLevMar_h
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifndef Opt_h
+#include "Opt.h"
+#endif
+
+#include "LSQNLF.h"
+
+namespace OPTPP {
+
+/**
+ * OptLevMar is a Levenberg-Marquardt method for the least squares
+ * problems of an LSQNLF,
+ *
+ *      min F(x) = r(x)'r(x),   r(x) = (r_1(x), ..., r_m(x)).
+ *
+ * Each iteration factors the m x n Jacobian J = QR with Householder
+ * transformations (LSQNLF::getQR) and keeps only R and Q'r, so a
+ * streaming LSQNLF, which never stores J, can be solved as well.  The step
+ * for the Marquardt parameter lambda is the least squares solution of
+ *
+ *      | R              |       | Q'r |
+ *      | sqrt(lambda) D | p = - |  0  |
+ *
+ * with D the column norms of J, so J'J is never formed and a rejected
+ * step costs O(n^3) instead of O(m n^2).  lambda is decreased after a
+ * good step and increased after a poor one as in Nielsen's update,
+ * so it acts as the inverse of a trust-region radius.  When the
+ * LSQNLF updates its Jacobian by Broyden's method, a poor step first
+ * triggers a difference Jacobian before lambda is increased.
+ *
+ * The convergence tests and return codes are those of OptCG: 1 to 4
+ * for the step, function and gradient tests, -1 if no step within
+ * the backtrack limit reduces F and -4 if the iteration or
+ * evaluation limit is reached.
+ */
+
+class OptLevMar: public OptimizeClass {
+private:
+  LSQNLF* nlp;			///< Pointer to the least squares problem
+  NEWMAT::ColumnVector diagD;	///< Column scaling of J
+  double lambda0;		///< Initial Marquardt parameter
+  double lambda;		///< Current Marquardt parameter
+  int grad_evals;		///< Number of Jacobian evaluations
+
+  /// R and Q'r of the current Jacobian, and update of the scaling
+  void factorJacobian(NEWMAT::UpperTriangularMatrix& R,
+		      NEWMAT::ColumnVector& qtr);
+  /// Step for the current lambda from R, Q'r and the scaling
+  NEWMAT::ColumnVector computeLMStep(const NEWMAT::UpperTriangularMatrix& R,
+				     const NEWMAT::ColumnVector& qtr) const;
+
+protected:
+  LSQNLF* nlprob() const { return nlp; }
+
+public:
+ /**
+  * Default Constructor
+  * @see OptLevMar(LSQNLF* p)
+  * @see OptLevMar(LSQNLF* p, TOLS t)
+  */
+  OptLevMar(): nlp(0), lambda0(1.e-3), lambda(1.e-3), grad_evals(0)
+    {strcpy(method,"Levenberg-Marquardt");}
+ /**
+  * @param p a pointer to an LSQNLF object
+  * @see OptLevMar(LSQNLF* p, TOLS t)
+  */
+  OptLevMar(LSQNLF* p): OptimizeClass(p->getDim()), nlp(p),
+    diagD(p->getDim()), lambda0(1.e-3), lambda(1.e-3), grad_evals(0)
+    {strcpy(method,"Levenberg-Marquardt");}
+ /**
+  * @param p a pointer to an LSQNLF object
+  * @param t a TOLS object
+  * @see OptLevMar(LSQNLF* p)
+  */
+  OptLevMar(LSQNLF* p, TOLS t): OptimizeClass(p->getDim(), t), nlp(p),
+    diagD(p->getDim()), lambda0(1.e-3), lambda(1.e-3), grad_evals(0)
+    {strcpy(method,"Levenberg-Marquardt");}
+
+  virtual ~OptLevMar(){}
+
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlp->setProfile(prof);}
+
+  /// Set the initial Marquardt parameter, relative to the column scaling
+  void setDamping(double l) {lambda0 = l;}
+  /// @return Current Marquardt parameter
+  double getDamping() const {return lambda;}
+
+  virtual NEWMAT::ColumnVector computeSearch(NEWMAT::SymmetricMatrix& )
+    {return NEWMAT::ColumnVector();}
+
+  virtual void acceptStep(int k, int step_type)
+    {OptimizeClass::defaultAcceptStep(k, step_type);}
+
+  virtual void updateModel(int k, int ndim, NEWMAT::ColumnVector x)
+    {OptimizeClass::defaultUpdateModel(k, ndim, x);}
+
+  virtual void readOptInput() {}
+
+  /// Check the step, function and gradient tolerances
+  virtual int checkConvg();
+  /// Reset the parameters
+  virtual void reset();
+  /// Initialize the optimization method
+  virtual void initOpt();
+  /// Run the optimization method
+  virtual void optimize();
+  /// Compute steplength
+  virtual real stepTolNorm() const;
+  /// Print the status of the optimization method
+  virtual void printStatus(char *);
+};
+
+} // namespace OPTPP
+#endif
@@ -0,0 +1,214 @@
+#ifndef OptMultiStart_h
+#define OptMultiStart_h
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include "Opt.h"
+#include "OptppArray.h"
+#include "OptppThreads.h"
+
+namespace OPTPP {
+
+/**
+ * Builds one local run of OptMultiStart: a problem whose current point
+ * is x0, and an optimizer working on it.  Both are created with new
+ * and handed over to OptMultiStart, which deletes them after the run.
+ * With several threads the function is called concurrently, so it
+ * must not change shared data without protection.
+ *
+ * The optimizer calls the init function of the problem when it starts,
+ * so that function must leave the current point alone; set x0 with
+ * nlp->setX(x0) instead.
+ *
+ * @param start Number of the start, 0,...,getNumStarts()-1
+ * @param x0 Starting point
+ * @param nlp Set to the problem the optimizer works on
+ * @param data Pointer given to the OptMultiStart constructor
+ * @return The optimizer, or 0 to skip this start
+ */
+typedef OptimizeClass* (*MULTISTARTFCN)(int start,
+					const NEWMAT::ColumnVector& x0,
+					NLP0*& nlp, void* data);
+
+/**
+ * A local minimizer found by OptMultiStart
+ */
+struct OptMultiStartResult {
+  NEWMAT::ColumnVector x;	///< Local minimizer
+  double f;			///< Objective value at x
+  int    start;			///< Start whose run gave x
+  int    hits;			///< Number of starts that led to x
+  int    ret_code;		///< Return code of that run
+};
+
+/**
+ * OptMultiStart runs a local optimizer from many starting points and
+ * collects the distinct local minima it finds.
+ *
+ * The starting points come from a Latin hypercube or a Sobol sequence
+ * in the box set with setBounds(), or are given by the user.  The runs
+ * are spread over a pool of threads, and with MPI also over the
+ * processes of MPI_COMM_WORLD, each of which takes every nproc-th
+ * start.
+ *
+ * The runs share the list of minima found so far.  A run is cancelled
+ * when its iterate comes close to a known minimum without being better
+ * than it, since it would most likely only find that minimum again.
+ * Optionally, a run whose objective value stays far above the best
+ * value found so far (the incumbent) is cancelled as well; see
+ * setCancelGap().  The optimizers must support
+ * OptimizeClass::setStopTest() for this; all others run to the end.
+ *
+ * Minima closer than the distance tolerance are merged, keeping the
+ * lower one (the one of the earlier start on a tie).  They are merged
+ * in start order once all runs are done, so which runs complete may
+ * depend on thread timing through cancellation, but not the minima
+ * found by a given set of completed runs.  The results are sorted by
+ * objective value.
+ */
+class OptMultiStart {
+public:
+  enum Design { LatinHypercube, Sobol, UserPoints };
+
+private:
+  int            n;
+  MULTISTARTFCN  factory;
+  void*          data;
+
+  Design         design;
+  int            nstarts;
+  int            nthreads;
+  unsigned long  seed;
+  bool           quiet;
+
+  NEWMAT::ColumnVector lower;
+  NEWMAT::ColumnVector upper;
+  NEWMAT::Matrix starts;	///< One starting point per column
+
+  double         dist_tol;
+  double         cancel_radius;
+  double         cancel_gap;
+  int            cancel_iter;
+
+  /// Minimum found during the runs; its point is kept in found_x
+  struct Found {
+    double f;
+    int    start, hits, ret_code;
+  };
+
+  OptppArray<Found>  found;
+  OptppArray<double> found_x;	///< n coordinates per minimum
+
+  /// End of one local run; merged into found in start order
+  struct Outcome {
+    double f;
+    int    start, ret_code;
+    bool   near;		///< cancelled close to a known minimum
+  };
+
+  OptppArray<Outcome> outcome;
+  OptppArray<double>  outcome_x;	///< n coordinates per local run
+  OptppArray<OptMultiStartResult> optima;
+  double         f_best;
+  int            ncancelled;
+  int            nfailed;
+  int            ret_code;
+  OptppMutex     mutex;
+
+  int  rank;
+  int  nproc;
+
+  void makeStarts();
+  void latinHypercube();
+  bool sobol();
+  double uniform();
+
+  int  find(const double* x, double tol) const;
+  void record(const double* x, double f, int start, int rc, int hits);
+  void merge();
+  void gather();
+  void sort();
+
+  static int  runStart(int i, void* self);
+  static bool stopTest(int k, double f, const NEWMAT::ColumnVector& x,
+		       void* run);
+
+  OptMultiStart(const OptMultiStart&);
+  OptMultiStart& operator=(const OptMultiStart&);
+
+public:
+/**
+ * @param ndim Number of variables
+ * @param fcn Builds the problem and optimizer of each start
+ * @param fcn_data Passed on to fcn
+ */
+  OptMultiStart(int ndim, MULTISTARTFCN fcn, void* fcn_data = 0);
+  ~OptMultiStart() {}
+
+/// Box the starting points are drawn from
+  void setBounds(const NEWMAT::ColumnVector& lo,
+		 const NEWMAT::ColumnVector& hi) { lower = lo; upper = hi;}
+/// How the starting points are placed in the box (default Sobol)
+  void setDesign(Design d) { design = d;}
+/// Use the columns of x as starting points
+  void setStartPoints(const NEWMAT::Matrix& x)
+    { starts = x; nstarts = x.Ncols(); design = UserPoints;}
+  void setNumStarts(int m) { nstarts = m;}
+/// Number of threads per process; default getNumProcs()
+  void setNumThreads(int t) { nthreads = t;}
+/// Seed of the random numbers of the Latin hypercube
+  void setSeed(unsigned long s) { seed = s;}
+/// Switch the output of every optimizer off (default true)
+  void setQuiet(bool q) { quiet = q;}
+/**
+ * Points x and y are the same minimum if
+ * ||x - y|| <= tol (1 + ||y||); default 1.e-4
+ */
+  void setDistanceTol(double tol) { dist_tol = tol;}
+/**
+ * Cancel a run when its iterate x comes within r (1 + ||y||) of a
+ * known minimum y with f(x) >= f(y); default 1.e-2, 0 turns this off
+ */
+  void setCancelRadius(double r) { cancel_radius = r;}
+/**
+ * Cancel a run when, after iter iterations, its objective value is
+ * still above fbest + gap (1 + |fbest|), fbest being the best value
+ * found so far.  A negative gap (the default) turns this off.
+ */
+  void setCancelGap(double gap, int iter = 10)
+    { cancel_gap = gap; cancel_iter = iter;}
+
+/**
+ * Run all starts.  Afterwards getReturnCode() is 0, or negative if
+ * the starting points could not be made.
+ */
+  void optimize();
+
+  int getReturnCode() const { return ret_code;}
+  int getNumStarts()  const { return nstarts;}
+/// Starting point i (column i+1), valid after optimize()
+  NEWMAT::ColumnVector getStart(int i) const { return starts.Column(i+1);}
+
+/// Number of distinct minima found
+  int getNumOptima() const { return optima.length();}
+/// Minimum i, in increasing order of objective value
+  const OptMultiStartResult& getOptimum(int i) const { return optima[i];}
+/// Runs cancelled early
+  int getNumCancelled() const { return ncancelled;}
+/// Starts skipped by the factory or ending with a negative return code
+  int getNumFailed() const { return nfailed;}
+
+  void printStatus(ostream& out) const;
+};
+
+} // namespace OPTPP
+
+#endif
@@ -45,6 +45,12 @@ class OptNIPSLike: public OptConstrNewtonLike {
   real		taumin_; ///< percentage of steplength to boundary
   const real	rho_;    ///< constant set to .5 
   const real	sw_;	///<  constant
+  bool		predictor_corrector_; ///< Use Mehrotra's predictor-corrector?
+  int		pc_rejected_; ///< predictor-corrector steps rejected so far
+  bool		trialF_; ///< Is f at the last trial point in the nlp?
+  bool		trialG_; ///< Is grad f at the last trial point in the nlp?
+  NEWMAT::ColumnVector trialResidual_; ///< constraint residual at the last trial point
+  NEWMAT::ColumnVector trialNLValue_;  ///< nonlinear constraint values there
 
  public:
  /**
@@ -55,14 +61,18 @@ class OptNIPSLike: public OptConstrNewtonLike {
   */
   OptNIPSLike(): OptConstrNewtonLike(), beta_(0.0e0), 
     dirder_(0.0e0), mu_(0.0e0), penalty_(0.0e0),
-    sigmin_(0.0e0), taumin_(0.0e0), rho_(0.0e0), sw_(0.0e0)
+    sigmin_(0.0e0), taumin_(0.0e0), rho_(0.0e0), sw_(0.0e0),
+    predictor_corrector_(false), pc_rejected_(0), trialF_(false),
+    trialG_(false)
     {strcpy(method,"Nonlinear Interior-Point Method");}
  /**
   * @param n an integer argument.
   */
   OptNIPSLike(int n): OptConstrNewtonLike(n), beta_(0.0e0), 
     dirder_(0.0e0), mu_(0.0e0), penalty_(1.0e2),
-    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2)
+    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2),
+    predictor_corrector_(false), pc_rejected_(0), trialF_(false),
+    trialG_(false)
     { strcpy(method,"Nonlinear Interior-Point Method"); }
  /**
   * @param n an integer argument.
@@ -70,7 +80,9 @@ class OptNIPSLike: public OptConstrNewtonLike {
   */
   OptNIPSLike(int n, UPDATEFCN u): OptConstrNewtonLike(n,u), beta_(0.0e0), 
     dirder_(0.0e0), mu_(0.0e0), penalty_(1.0e2),
-    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2)
+    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2),
+    predictor_corrector_(false), pc_rejected_(0), trialF_(false),
+    trialG_(false)
     { strcpy(method,"Nonlinear Interior-Point Method"); }
  /**
   * @param n an integer argument.
@@ -78,7 +90,9 @@ class OptNIPSLike: public OptConstrNewtonLike {
   */
   OptNIPSLike(int n, TOLS t): OptConstrNewtonLike(n,t), beta_(0.0e0), 
     dirder_(0.0e0), mu_(0.0e0), penalty_(1.0e2),
-    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2)
+    sigmin_(0.1e0), taumin_(0.95e0), rho_(5.0e-1), sw_(1.0e2),
+    predictor_corrector_(false), pc_rejected_(0), trialF_(false),
+    trialG_(false)
     { strcpy(method,"Nonlinear Interior-Point Method"); }
 
  /**
@@ -116,6 +130,12 @@ class OptNIPSLike: public OptConstrNewtonLike {
 // Accessor Methods
 //-------------------------------------------------------------------
 
+/**
+ * @return The Hessian of the Lagrangian; pass it to UseWarmStart()
+ * to start a related problem from it
+ */
+  NEWMAT::SymmetricMatrix getHessianLagrangian() const { return hessl;}
+
 /**
  * @return The value of mu_, the pertubation parameter
  */
@@ -135,6 +155,27 @@ class OptNIPSLike: public OptConstrNewtonLike {
  */
   void setStepLengthToBdry(real newTau) { taumin_ = newTau;}
 
+/**
+ * Use Mehrotra's predictor-corrector steps: an affine scaling
+ * (mu = 0) predictor gives the centering parameter
+ * sigma = (mu_aff/mu)^3, and the step then solves for sigma*mu with
+ * the second order term dS_aff dZ_aff added to the complementarity
+ * rows.  Both solves use the same factorization of the KKT matrix.
+ * When the line search fails along such a step, the Newton step for
+ * the default mu is taken instead.  Only has an effect with
+ * inequality constraints.
+ */
+  void setPredictorCorrector(bool flag) { predictor_corrector_ = flag;}
+/**
+ * @return Are Mehrotra's predictor-corrector steps used?
+ */
+  bool getPredictorCorrector() const { return predictor_corrector_;}
+/**
+ * @return Number of predictor-corrector steps of the last run that the
+ * line search rejected in favor of the Newton step
+ */
+  int getRejectedPCSteps() const { return pc_rejected_;}
+
 //-------------------------------------------------------------------
 // These are used by the derived classes 
 //-------------------------------------------------------------------
@@ -148,6 +189,26 @@ class OptNIPSLike: public OptConstrNewtonLike {
   void recoverFeasibility(NEWMAT::ColumnVector xinit, CompoundConstraint* constraints, 
                           double ftol);
   NEWMAT::ColumnVector computeSearch2(NEWMAT::Matrix& Jacobian, const NEWMAT::ColumnVector& rhs);
+  /**
+   * Solve the Newton system with an already factored KKT matrix
+   * @param kkt LU factorization of the matrix from setupMatrix
+   * @param rhs right-hand side
+   */
+  NEWMAT::ColumnVector computeSearch2(const NEWMAT::CroutMatrix& kkt,
+				      const NEWMAT::ColumnVector& rhs);
+  /**
+   * Mehrotra predictor-corrector step at xprev; sets mu_ to sigma*mu
+   * @param kkt LU factorization of the matrix from setupMatrix
+   * @param F0 right-hand side at xprev for mu = 0
+   */
+  NEWMAT::ColumnVector computeMehrotraStep(const NEWMAT::CroutMatrix& kkt,
+					   const NEWMAT::ColumnVector& F0);
+  /**
+   * Right-hand side for mu from the one for mu = 0: only the last mi
+   * rows, the complementarity conditions s.*z - mu, depend on mu
+   */
+  NEWMAT::ColumnVector shiftRHS(const NEWMAT::ColumnVector& F0,
+				real mu) const;
   /**
    * Takes two arguments and returns a NEWMAT::ColumnVector.
    * @param df a NEWMAT::ColumnVector - gradient of obj. function
@@ -162,6 +223,15 @@ class OptNIPSLike: public OptConstrNewtonLike {
    */
   void updateMu(int k);
 
+  /**
+   * Evaluates the objective and the constraints once at a trial point
+   * of computeStep.  The merit functions use these values and
+   * computeStep keeps them when the point is accepted.
+   * @param xt a NEWMAT::ColumnVector - trial point
+   * @param grad a bool - evaluate grad f(xt) rather than f(xt)?
+   */
+  void evalTrialPoint(const NEWMAT::ColumnVector& xt, bool grad);
+
   /**
    * Takes five arguments and returns a real value.
    * @param flag an integer argument
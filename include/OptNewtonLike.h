@@ -33,9 +33,12 @@ protected:
   real TR_size;			///< Trust region radius
   real gradMult;		///< Gradient multiplier to compute TR_size
   int searchSize;               ///< Search pattern size for TRPDS
+  bool firstPDSStep;            ///< No TRPDS step accepted yet
   void defaultAcceptStep(int, int);
   NEWMAT::ColumnVector defaultComputeSearch(NEWMAT::SymmetricMatrix& );
   bool WarmStart;
+  void putState(OptppCheckpoint&) const;  ///< Save state for a restart
+  void getState(OptppCheckpointReader&);  ///< Restore it
 
 public:
 
@@ -53,7 +56,7 @@ public:
   OptNewtonLike(int n): 
     OptimizeClass(n), gprev(n), Hessian(n), grad_evals(0),
     strategy(TrustRegion), finitediff(ForwardDiff), TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false){}
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false){}
 
  /**
   * @param n an integer argument.
@@ -62,7 +65,7 @@ public:
   OptNewtonLike(int n, UPDATEFCN u): 
     OptimizeClass(n), gprev(n), Hessian(n),grad_evals(0),
     strategy(TrustRegion), finitediff(ForwardDiff),TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false){update_fcn = u;}
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false){update_fcn = u;}
  /**
   * @param n an integer argument.
   * @param t tolerance class reference.
@@ -70,7 +73,7 @@ public:
   OptNewtonLike(int n, TOLS t): 
     OptimizeClass(n,t), gprev(n), Hessian(n), grad_evals(0),
     strategy(TrustRegion), finitediff(ForwardDiff),TR_size(0.0),
-    gradMult(0.1), searchSize(64), WarmStart(false){}
+    gradMult(0.1), searchSize(64), firstPDSStep(true), WarmStart(false){}
   
  /**
   * Destructor
@@ -168,7 +171,12 @@ public:
   void setSearchSize(int sss) {searchSize = sss;}
 
   bool getWarmStart() const {return WarmStart;}
-  void UseWarmStart(NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+  /// Start the next optimization from H, e.g. getHessian() of a related solve
+  void UseWarmStart(const NEWMAT::SymmetricMatrix& H) {Hessian = H; WarmStart = true;}
+
+  /// Attach a profile to this optimizer and its NLP
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlprob()->setProfile(prof);}
 
   /**
    * @return Globalization strategy for optimization algorithms 
@@ -204,7 +212,7 @@ public:
 
   friend int trustpds(NLP1*, ostream*, NEWMAT::SymmetricMatrix&,
 		      NEWMAT::ColumnVector&, NEWMAT::ColumnVector&,
-		      real&, real&, real stpmax, real stpmin, int);
+		      real&, real&, real stpmax, real stpmin, int, bool*);
 
 };
 
@@ -16,7 +16,7 @@
 #include <stdio.h>
 #endif
 
-#include "Opt.h"
+#include "OptDirect.h"
 #include "NLP0.h"
 #include "NLP.h"
 
@@ -25,32 +25,33 @@ using std::ostream;
 
 namespace OPTPP {
 
-/**
- * OptDirect is a derived class of OptimizeClass and the base class for direct
- * search methods.  In OPT++, OptGA, a genetic algorithm, and OptPDS, 
- * a parallel direct search method, are examples of direct search methods.  
- */
-
-class OptDirect: public OptimizeClass {
- protected:
- public:
-  OptDirect(){}
-  OptDirect(int n): OptimizeClass(n){}
-  OptDirect(int n, TOLS t): OptimizeClass(n,t){}
-  virtual ~OptDirect(){}
-  virtual void acceptStep(int, int) = 0;
-  virtual void updateModel(int, int, NEWMAT::ColumnVector) = 0;
-
-  virtual int checkConvg() {return 0;}
-  virtual void optimize() {}
-  virtual void readOptInput() {}
-  virtual void reset() {}
-};
-
 //----------------------------------------------------------------------
 // Parallel Direct Search Method
 //----------------------------------------------------------------------
 
+class OptPDS;
+
+/**
+ * PDSState holds what pdswork() needs to continue a PDS run: the
+ * simplex, the permutation pointing to its best vertex, the best
+ * value, the edge length and the counters.  OptPDS passes one to
+ * pdsopt(); pdswork() fills it in after every iteration and lets
+ * the OptPDS write a checkpoint, and when resume is set it starts
+ * from the saved state instead of building the initial simplex.
+ */
+struct PDSState {
+  OptPDS*              opt;       ///< Optimizer to checkpoint, or 0
+  bool                 resume;    ///< Continue from this state
+  NEWMAT::ColumnVector simplex;   ///< n+1 unscaled vertices
+  OptppArray<int>      index;     ///< pds_index of pdswork()
+  NEWMAT::ColumnVector xcenter;   ///< Center of the trust region
+  double               fbest, length, finit, fprev;
+  int                  count[3];  ///< Iterations, fevals, constraint evals
+  int                  resize, num;
+
+  PDSState(): opt(0), resume(false) {}
+};
+
 /**
  * OptPDS is an implementation of a derivative-free algorithm for
  * unconstrained optimization.  The search direction is driven solely
@@ -60,6 +61,11 @@ class OptDirect: public OptimizeClass {
  * processors and to addapt to any cost ratio of communication to function
  * evaluation.  
  *
+ * The points of the search scheme are split among the MPI processes,
+ * and each process evaluates its share on NLP0::getNumThreads()
+ * threads, so PDS can run on MPI alone, on threads alone, or on
+ * both.
+ *
  * For a further description of the parallel direct search methods see
  * J. E. Dennis, Jr. and Virginia Torczon, "Direct Search Methods on
  * Parallel Machines," SIAM J. Optimization, Vol. 1, No. 4,
@@ -81,7 +87,12 @@ protected:
   double simplex_size;
 
   bool create_scheme_flag, first, trpds;
+  bool scheme_cache_flag;	///< Save/reuse the scheme in schemefile_name
   char schemefile_name[80];
+  PDSState pds_state;		///< State of the running iteration
+
+  void putState(OptppCheckpoint& ck) const;
+  void getState(OptppCheckpointReader& ck);
 
 public:
   OptPDS(){}
@@ -89,7 +100,7 @@ public:
       simplex(p->getDim(),p->getDim()+1), vscales(p->getDim()),
       search_scheme_size(64), simplex_type(2), 
       reset_param(0), tr_size(0.0), simplex_size(0.0), create_scheme_flag(true),
-      trpds(false) { strcpy(method,"PDS");
+      trpds(false), scheme_cache_flag(false) { strcpy(method,"PDS");
       strcpy(schemefile_name,"SCHEME");  vscales = 1.0; NEWMAT::ColumnVector x
 							  = p->getXc();
       double perturb;
@@ -108,7 +119,7 @@ public:
       simplex(p->getDim(),p->getDim()+1), vscales(p->getDim()),
       search_scheme_size(64), simplex_type(2),
       reset_param(0), tr_size(0.0), simplex_size(0.0), create_scheme_flag(true),
-      trpds(false) { strcpy(method,"PDS");
+      trpds(false), scheme_cache_flag(false) { strcpy(method,"PDS");
       strcpy(schemefile_name,"SCHEME"); vscales = 1.0; NEWMAT::ColumnVector x
 							 = p->getXc();
       double perturb;
@@ -152,8 +163,15 @@ public:
 /// Set simplex used by the algorithm 
   void setSimplex(NEWMAT::Matrix &m)         {simplex = m;};
 
+/// Build the search scheme (true) or read it from the scheme file
   void setCreateFlag(bool flag=true) {create_scheme_flag = flag;};
 
+/// Keep an on-disk copy of built schemes so that later runs skip make_search
+  void setSchemeCache(bool flag=true) {scheme_cache_flag = flag;};
+
+/// Release the search schemes shared by all PDS runs in this process
+  static void clearSchemeCache();
+
 /// Override the default value of filename
   void setSchemeFileName(char *s)    {strcpy(schemefile_name,s);};
 
@@ -163,6 +181,13 @@ public:
 /// Set simplex size 
   void setSimplexSize(double len)    {simplex_size = len;}
 
+/// Attach a profile to the search and its NLP; pdswork() closes a record per iteration
+  void setProfile(OptppProfile* prof)
+    {OptimizeClass::setProfile(prof); nlp->setProfile(prof);}
+
+/// Called by pdswork() once pds_state holds the state after iteration k
+  void checkpointIteration(int k)   {writeCheckpoint(k);}
+
 /// Set first nonlinear iteration to either true or false
   void setNonIter(bool init=false)   {first = init;}
   void setTRPDS(bool trcon=false)   {trpds = trcon;}
@@ -171,6 +196,7 @@ public:
   int getSSS()              const {return search_scheme_size;}
   NEWMAT::ColumnVector& getScale()  {return vscales;};
   bool getCreateFlag()      const {return create_scheme_flag;};
+  bool getSchemeCache()     const {return scheme_cache_flag;};
   char *getSchemeFileName() {return schemefile_name;};
   double getTRSize()        {return tr_size;}
   double getSimplexSize()   {return simplex_size;}
@@ -191,17 +217,23 @@ int pdsinit(NLP0 *, ostream *, int, int, int *, int *, double,
 	    double *, double *, double *, char *, double, int, int,
 	    double);
 
-int pdsopt(NLP0 *, ostream *, double *, int *, int, char *, int, int,
-	   double, int, int, double, double *, double, int, double *,
-	   int *, char *, double, double, double *, int, int, int,
-	   double);
+int pdsopt(NLP0 *, ostream *, double *, int *, int, int, char *, int,
+	   int, double, int, int, double, double *, double, int,
+	   double *, int *, char *, double, double, double *, int, int,
+	   int, double, PDSState * = 0);
 
 int pdswork(NLP0 *, ostream *, ofstream *, int, double, int, int, int *, 
 	    double, int, double *, double *, int *, double *, double *,
 	    int *, int, double, double *, char *, double, double, int,
-	    int, int, double, FILE *);
+	    int, int, double, const int *, int, PDSState * = 0);
 
 int pdschk(NLP0 *,int, double *, double *, double, double *, int, double);  
 
+int create_scheme(ostream *, int, int, int **, int, int);
+
+int get_scheme(ostream *, int, int, int, int, char *, int **, int, int);
+
+void clear_scheme_cache();
+
 } // namespace OPTPP
 #endif
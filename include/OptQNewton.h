@@ -4,6 +4,7 @@
 #ifndef OptNewtonLike_h
 #include "OptNewtonLike.h"
 #endif
+#include "PSNLF.h"
 
 
 namespace OPTPP {
@@ -13,13 +14,35 @@ namespace OPTPP {
  * This class implements an unconstrained Quasi-Newton Method
  * with BFGS approximation to the Hessian.  The user can select
  * from the following globalization strategies: linesearch, trust-region,
- * and trustpds.
+ * trustpds, and a parallel linesearch (ParallelLineSearch) that
+ * evaluates several trial steps at once.
+ *
+ * For a partially separable problem (PSNLF) the Hessian approximation
+ * is the sum of one small BFGS matrix per element, each updated with
+ * the element's own step and gradient change (partitioned
+ * quasi-Newton updates, Griewank and Toint).  The updates keep the
+ * sparsity of the Hessian and capture the curvature of each element,
+ * so they often need fewer iterations than a dense BFGS update.
  *
  * @author J.C. Meza, Sandia National Laboratories,meza@ca.sandia.gov
  * @note Modified by P.J. Williams, pwillia@sandia.gov 
  */
 
 class OptQNewton: public OptNewton1Deriv {
+ protected:
+  PSNLF* psnlp;			///< The problem, if it is partially separable
+  bool partitioned;		///< Use partitioned updates?
+  OptppArray<NEWMAT::SymmetricMatrix> elH; ///< Element Hessian approximations
+  OptppArray<NEWMAT::ColumnVector> elGprev; ///< Element gradients at xprev
+  NEWMAT::ColumnVector Hfree;	///< Diagonal for variables of no element
+
+  /// Split the entries of H covered by the elements among them
+  void initElementH(const NEWMAT::SymmetricMatrix& H);
+  /// Partitioned BFGS update of the element matrices, assembled
+  NEWMAT::SymmetricMatrix updatePartitionedH(NEWMAT::SymmetricMatrix& H);
+  void putState(OptppCheckpoint&) const;  ///< Save state for a restart
+  void getState(OptppCheckpointReader&);  ///< Restore it
+
  public:
   /**
    * Default Constructor
@@ -27,23 +50,39 @@ class OptQNewton: public OptNewton1Deriv {
    * @see OptQNewton(NLP1* p, UPDATEFCN u)
    * @see OptQNewton(NLP1* p, TOLS t)
    */
-  OptQNewton(){strcpy(method,"Quasi-Newton");}
+  OptQNewton(): psnlp(0), partitioned(false)
+    {strcpy(method,"Quasi-Newton");}
   /**
    * @param p a pointer to an NLP1.
    */
-  OptQNewton(NLP1* p): OptNewton1Deriv(p)
+  OptQNewton(NLP1* p): OptNewton1Deriv(p), psnlp(0), partitioned(false)
     {strcpy(method,"Quasi-Newton");}
   /**
    * @param p a pointer to an NLP1.
    * @param u a function pointer.
    */
-  OptQNewton(NLP1* p, UPDATEFCN u): OptNewton1Deriv(p, u)
+  OptQNewton(NLP1* p, UPDATEFCN u): OptNewton1Deriv(p, u), psnlp(0),
+    partitioned(false)
     {strcpy(method,"Quasi-Newton"); }
   /**
    * @param p a pointer to an NLP1.
    * @param t tolerance class reference.
    */
-  OptQNewton(NLP1* p, TOLS t): OptNewton1Deriv(p, t)
+  OptQNewton(NLP1* p, TOLS t): OptNewton1Deriv(p, t), psnlp(0),
+    partitioned(false)
+    {strcpy(method,"Quasi-Newton"); }
+  /**
+   * A partially separable problem, solved with partitioned updates
+   * @param p a pointer to a PSNLF.
+   */
+  OptQNewton(PSNLF* p): OptNewton1Deriv(p), psnlp(p), partitioned(true)
+    {strcpy(method,"Quasi-Newton");}
+  /**
+   * @param p a pointer to a PSNLF.
+   * @param t tolerance class reference.
+   */
+  OptQNewton(PSNLF* p, TOLS t): OptNewton1Deriv(p, t), psnlp(p),
+    partitioned(true)
     {strcpy(method,"Quasi-Newton"); }
 
   /**
@@ -61,6 +100,17 @@ class OptQNewton: public OptNewton1Deriv {
   /// Compare the analytic gradient with the finite difference gradient
   int checkDeriv();
 
+  /// Initial Hessian approximation, split among the elements of a PSNLF
+  virtual void initHessian();
+
+  /**
+   * Use partitioned updates for a PSNLF (the default) or a dense BFGS
+   * update; has no effect for other problems
+   */
+  void setPartitionedUpdate(bool p) {partitioned = p;}
+  /// @return Are partitioned updates used?
+  bool getPartitionedUpdate() const {return psnlp != 0 && partitioned;}
+
  // virtual double initTrustRegionSize() const;
 };
 
@@ -15,6 +15,7 @@ class OptGSS_params {
   double Theta;
   int    Iter_max;
   bool   SearchAll;
+  bool   Async;
   bool   printCOPYRIGHT;
   bool   printXiter;
   bool   printGiter;
@@ -26,6 +27,7 @@ class OptGSS_params {
     Theta(0.5), 
     Iter_max(10000), 
     SearchAll(true), 
+    Async(false), 
     printCOPYRIGHT(false), 
     printXiter(false), 
     printGiter(false)
@@ -0,0 +1,102 @@
+#ifndef OPTPPASYNCBUF_H
+#define OPTPPASYNCBUF_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include <streambuf>
+
+#include "OptppThreads.h"
+
+namespace OPTPP {
+
+/**
+ * OptppAsyncBuf is a stream buffer that hands the text written to it
+ * to a background thread, which writes it to a target stream buffer.
+ * The optimizer only pays for copying the text into a ring buffer of
+ * fixed size; formatting aside, the cost of the file system calls
+ * moves off its critical path.
+ *
+ * Text is collected in a small local buffer and passed on whenever
+ * that fills up or the stream is flushed.  The ring buffer between
+ * the writing thread and the background thread is lock-free; there
+ * must only be one writing thread at a time.
+ *
+ * When the ring buffer is full the writer either waits for the
+ * background thread (Block) or discards the pending text (Drop);
+ * getDropped() tells how many characters were lost.
+ *
+ * Without thread support the text is written to the target directly.
+ */
+class OptppAsyncBuf: public std::streambuf {
+public:
+  enum Policy { Block, Drop };
+
+private:
+  enum { LocalSize = 4096 };
+
+  std::streambuf* target;
+  Policy          policy;
+
+  char*           ring;
+  unsigned long   mask;           ///< ring size - 1, size is a power of 2
+  unsigned long   head;           ///< written by the producer only
+  unsigned long   tail;           ///< written by the background thread only
+  int             waiting;        ///< background thread is asleep
+  int             idle;           ///< ring is empty and target synced
+  int             stop;
+  unsigned long   dropped;
+
+  char            local[LocalSize];
+
+  OptppMutex      mutex;
+  OptppCondition  wakeup;
+  bool            running;
+#ifdef WITH_THREADS
+  pthread_t       thread;
+#endif
+
+  bool push(const char* p, unsigned long len);
+  void notify();
+  void run();
+  static void* writer(void* arg);
+
+  OptppAsyncBuf(const OptppAsyncBuf&);
+  OptppAsyncBuf& operator=(const OptppAsyncBuf&);
+
+protected:
+  int_type overflow(int_type c);
+  int sync();
+
+public:
+  /**
+   * @param t Stream buffer the text finally goes to
+   * @param capacity Size of the ring buffer in bytes, rounded up to a
+   * power of 2
+   * @param p What to do when the ring buffer is full
+   */
+  OptppAsyncBuf(std::streambuf* t, unsigned long capacity = 1 << 20,
+		Policy p = Block);
+  /// Writes out everything pending and stops the background thread
+  ~OptppAsyncBuf();
+
+  /// Wait until everything written so far has reached the target
+  void drain();
+  /// Drain, then send all further text to t
+  void setTarget(std::streambuf* t);
+  std::streambuf* getTarget() const { return target;}
+
+  /// Number of characters discarded under the Drop policy
+  unsigned long getDropped() const { return dropped;}
+};
+
+} // namespace OPTPP
+
+#endif
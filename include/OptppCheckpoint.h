@@ -0,0 +1,140 @@
+#ifndef OPTPPCHECKPOINT_H
+#define OPTPPCHECKPOINT_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#ifdef HAVE_STD
+#include <cstdio>
+#else
+#include <stdio.h>
+#endif
+
+#include <string>
+
+#include "newmat.h"
+#include "OptppArray.h"
+
+namespace OPTPP {
+
+/**
+ * Binary checkpoint of the state of an optimizer
+ *
+ * A checkpoint file starts with the header
+ *
+ *   char[8]  magic     "OPTCHKPT"
+ *   uint32   byteorder 0x01020304 in the byte order of the writer
+ *   uint32   version   OptppCheckpoint::Version
+ *   int32    n         number of variables
+ *   int32    len       length of the tag
+ *   char     tag[len]  name of the method that wrote the file
+ *
+ * followed by the values the method saves, in the order it saves
+ * them, and ends with the 8 characters "ENDCHKPT".  Scalars are
+ * stored as they are; vectors and matrices are preceded by their
+ * int32 dimensions, symmetric matrices store their lower triangle.
+ * Values are written in the byte order of the writer and swapped by
+ * the reader when the byteorder tag says so.
+ *
+ * The file is written under a temporary name and renamed when it is
+ * complete, so a crash while writing leaves the previous checkpoint
+ * in place.  Under MPI only process 0 writes.
+ */
+class OptppCheckpoint {
+public:
+  enum { Version = 1 };
+
+private:
+  FILE*       fp;
+  std::string name;
+  std::string tmpname;
+  bool        ok;
+
+  void write(const void* p, size_t len);
+
+  OptppCheckpoint(const OptppCheckpoint&);
+  OptppCheckpoint& operator=(const OptppCheckpoint&);
+
+public:
+  OptppCheckpoint(): fp(0), ok(false) {}
+  ~OptppCheckpoint() { discard();}
+
+  /**
+   * Start a checkpoint of method tag for an n-dimensional problem.
+   * @return false if the temporary file cannot be created
+   */
+  bool open(const char* filename, const char* tag, int n);
+  /**
+   * Finish the file and put it in place of filename.
+   * @return false if any write failed; filename is then unchanged
+   */
+  bool commit();
+  /// Drop an unfinished checkpoint
+  void discard();
+
+  void put(int i);
+  void put(bool b) { put(b? 1 : 0);}
+  void put(double x);
+  void put(const NEWMAT::ColumnVector& v);
+  void put(const NEWMAT::SymmetricMatrix& S);
+  void put(const NEWMAT::Matrix& M);
+  void put(const OptppArray<int>& a);
+  /// len doubles, preceded by len
+  void put(const double* x, int len);
+};
+
+/**
+ * OptppCheckpointReader reads back a file written by OptppCheckpoint.
+ * The get functions return false once a read has failed or found
+ * dimensions that do not match; the target is then left unchanged.
+ */
+class OptppCheckpointReader {
+  FILE* fp;
+  bool  swap;
+  bool  ok;
+
+  bool read(void* p, size_t len);
+  bool readInts(int* p, int len);
+  bool readDoubles(double* p, int len);
+
+  OptppCheckpointReader(const OptppCheckpointReader&);
+  OptppCheckpointReader& operator=(const OptppCheckpointReader&);
+
+public:
+  OptppCheckpointReader(): fp(0), swap(false), ok(false) {}
+  ~OptppCheckpointReader() { if (fp != 0) fclose(fp);}
+
+  /**
+   * @return false unless filename is a checkpoint written by method
+   * tag for an n-dimensional problem
+   */
+  bool open(const char* filename, const char* tag, int n);
+  /**
+   * Close the file.
+   * @return true if every read succeeded and the end of the
+   * checkpoint was found where expected
+   */
+  bool close();
+  bool good() const { return ok;}
+
+  bool get(int& i);
+  bool get(bool& b);
+  bool get(double& x);
+  bool get(NEWMAT::ColumnVector& v);
+  bool get(NEWMAT::SymmetricMatrix& S);
+  bool get(NEWMAT::Matrix& M);
+  bool get(OptppArray<int>& a);
+  /// len doubles, as written by OptppCheckpoint::put(x, len)
+  bool get(double* x, int len);
+};
+
+} // namespace OPTPP
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef OPTPPFILEBUF_H
+#define OPTPPFILEBUF_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include <fstream>
+#include <string>
+
+namespace OPTPP {
+
+/**
+ * OptppFileBuf is a file buffer that can defer opening its file until
+ * the first character is written to it.  An optimizer whose output is
+ * redirected, or never written, thus never touches its default file.
+ */
+class OptppFileBuf: public std::filebuf {
+  std::string             pending;
+  std::ios_base::openmode pending_mode;
+
+  /// Open the deferred file, if any
+  bool openPending();
+
+protected:
+  int_type        overflow(int_type c);
+  std::streamsize xsputn(const char* s, std::streamsize n);
+
+public:
+  OptppFileBuf(): pending_mode(std::ios_base::out) {}
+
+  /**
+   * Open filename with mode m when the first character is written.
+   * Any open file is closed now.
+   */
+  void openLazy(const char* filename,
+		std::ios_base::openmode m = std::ios_base::out);
+
+  /// Close the file and forget a deferred one
+  void closeAll() { pending.clear(); close();}
+
+  /// @return true if a file is open or waiting to be opened
+  bool isAttached() const { return is_open() || !pending.empty();}
+};
+
+} // namespace OPTPP
+
+#endif
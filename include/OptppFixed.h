@@ -0,0 +1,288 @@
+#ifndef OptppFixed_h
+#define OptppFixed_h
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#ifdef HAVE_STD
+#include <cfloat>
+#include <cmath>
+#else
+#include <float.h>
+#include <math.h>
+#endif
+
+#include "newmat.h"
+
+namespace OPTPP {
+
+/**
+ * Vectors and matrices whose size N is fixed at compile time.  They
+ * are meant for problems with a handful of variables (N up to 16 or
+ * so), where the heap allocation and index checking of NEWMAT cost
+ * more than the arithmetic.  The elements live inside the object, and
+ * every loop has the constant trip count N, so the compiler can keep
+ * the elements in registers and unroll the loops.
+ *
+ * Indices start at 1, as in NEWMAT, and are not checked.
+ */
+template<int N> class FixedVector {
+  double v[N];
+public:
+  FixedVector() {}
+  explicit FixedVector(double s) { *this = s;}
+  explicit FixedVector(const NEWMAT::ColumnVector& x)
+    { for (int i = 0; i < N; i++) v[i] = x(i+1);}
+
+  FixedVector& operator=(double s)
+    { for (int i = 0; i < N; i++) v[i] = s; return *this;}
+
+  double& operator()(int i)       { return v[i-1];}
+  double  operator()(int i) const { return v[i-1];}
+  double* Store()             { return v;}
+  const double* Store() const { return v;}
+  int Nrows() const           { return N;}
+
+  FixedVector& operator+=(const FixedVector& y)
+    { for (int i = 0; i < N; i++) v[i] += y.v[i]; return *this;}
+  FixedVector& operator-=(const FixedVector& y)
+    { for (int i = 0; i < N; i++) v[i] -= y.v[i]; return *this;}
+  FixedVector& operator*=(double s)
+    { for (int i = 0; i < N; i++) v[i] *= s; return *this;}
+
+  /// this += a*y
+  void axpy(double a, const FixedVector& y)
+    { for (int i = 0; i < N; i++) v[i] += a*y.v[i];}
+
+  NEWMAT::ColumnVector asColumnVector() const
+    {
+      NEWMAT::ColumnVector x(N);
+      for (int i = 0; i < N; i++) x(i+1) = v[i];
+      return x;
+    }
+};
+
+/// Symmetric matrix, stored as its packed lower triangle
+template<int N> class FixedSymMatrix {
+  double a[N*(N+1)/2];
+  static int idx(int i, int j)
+    { return (i >= j)? i*(i-1)/2 + j - 1 : j*(j-1)/2 + i - 1;}
+public:
+  FixedSymMatrix() {}
+  explicit FixedSymMatrix(const NEWMAT::SymmetricMatrix& S)
+    {
+      for (int i = 1; i <= N; i++)
+	for (int j = 1; j <= i; j++) a[idx(i,j)] = S(i,j);
+    }
+
+  FixedSymMatrix& operator=(double s)
+    { for (int i = 0; i < N*(N+1)/2; i++) a[i] = s; return *this;}
+
+  double& operator()(int i, int j)       { return a[idx(i,j)];}
+  double  operator()(int i, int j) const { return a[idx(i,j)];}
+  int Nrows() const { return N;}
+
+  /// Set to s times the identity
+  void setDiagonal(double s)
+    {
+      *this = 0.0;
+      for (int i = 1; i <= N; i++) a[idx(i,i)] = s;
+    }
+
+  NEWMAT::SymmetricMatrix asSymmetricMatrix() const
+    {
+      NEWMAT::SymmetricMatrix S(N);
+      for (int i = 1; i <= N; i++)
+	for (int j = 1; j <= i; j++) S(i,j) = a[idx(i,j)];
+      return S;
+    }
+};
+
+/// Lower triangular matrix, stored packed by rows
+template<int N> class FixedLowerMatrix {
+  double a[N*(N+1)/2];
+public:
+  FixedLowerMatrix() {}
+
+  FixedLowerMatrix& operator=(double s)
+    { for (int i = 0; i < N*(N+1)/2; i++) a[i] = s; return *this;}
+
+  /// Only defined for i >= j
+  double& operator()(int i, int j)       { return a[i*(i-1)/2 + j - 1];}
+  double  operator()(int i, int j) const { return a[i*(i-1)/2 + j - 1];}
+  int Nrows() const { return N;}
+
+  NEWMAT::LowerTriangularMatrix asLowerTriangularMatrix() const
+    {
+      NEWMAT::LowerTriangularMatrix L(N);
+      for (int i = 1; i <= N; i++)
+	for (int j = 1; j <= i; j++) L(i,j) = (*this)(i,j);
+      return L;
+    }
+};
+
+//------------------------------------------------------------------------
+// Basic operations
+//------------------------------------------------------------------------
+
+template<int N>
+inline double Dot(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  double s = 0.0;
+  for (int i = 1; i <= N; i++) s += x(i)*y(i);
+  return s;
+}
+
+template<int N>
+inline double Norm2(const FixedVector<N>& x) { return sqrt(Dot(x,x));}
+
+template<int N>
+inline double NormInfinity(const FixedVector<N>& x)
+{
+  double s = 0.0;
+  for (int i = 1; i <= N; i++) if (fabs(x(i)) > s) s = fabs(x(i));
+  return s;
+}
+
+/// y = S x
+template<int N>
+inline void multiply(const FixedSymMatrix<N>& S, const FixedVector<N>& x,
+		     FixedVector<N>& y)
+{
+  for (int i = 1; i <= N; i++) {
+    double s = 0.0;
+    for (int j = 1; j <= N; j++) s += S(i,j)*x(j);
+    y(i) = s;
+  }
+}
+
+/// Solve L L' x = b; x may be b
+template<int N>
+inline void cholSolve(const FixedLowerMatrix<N>& L, const FixedVector<N>& b,
+		      FixedVector<N>& x)
+{
+  int i, j;
+  for (i = 1; i <= N; i++) {
+    double s = b(i);
+    for (j = 1; j < i; j++) s -= L(i,j)*x(j);
+    x(i) = s / L(i,i);
+  }
+  for (i = N; i >= 1; i--) {
+    double s = x(i);
+    for (j = i+1; j <= N; j++) s -= L(j,i)*x(j);
+    x(i) = s / L(i,i);
+  }
+}
+
+//------------------------------------------------------------------------
+// Perturbed Cholesky decomposition, the same algorithm as MCholesky()
+// and PertChol() in mcholesky.C.  Like MCholesky(), it adds the
+// perturbation to the diagonal of S.
+//------------------------------------------------------------------------
+
+template<int N>
+void PertChol(const FixedSymMatrix<N>& S, double maxoffl, double& maxadd,
+	      FixedLowerMatrix<N>& L)
+{
+  const double mcheps = DBL_EPSILON;
+  double sum, minl2 = 0.0, minl = pow(mcheps,.25)*maxoffl;
+  int i, j, k;
+
+  if (maxoffl == 0.0) {
+    double maxdiag = 0.0;
+    for (i = 1; i <= N; i++)
+      if (fabs(S(i,i)) > maxdiag) maxdiag = fabs(S(i,i));
+    maxoffl = sqrt(maxdiag);
+    minl2 = sqrt(mcheps)*maxoffl;
+  }
+  maxadd = 0.0;
+
+  for (j = 1; j <= N; j++) {
+    sum = 0.0;
+    for (i = 1; i <= j-1; i++) sum += L(j,i)*L(j,i);
+    double ljj = S(j,j) - sum, minljj = 0.0;
+
+    for (i = j+1; i <= N; i++) {
+      sum = 0.0;
+      for (k = 1; k <= j-1; k++) sum += L(i,k)*L(j,k);
+      L(i,j) = S(j,i) - sum;
+      if (fabs(L(i,j)) > minljj) minljj = fabs(L(i,j));
+    }
+    minljj = minljj/maxoffl;
+    if (minl > minljj) minljj = minl;
+
+    if (ljj > minljj*minljj)
+      L(j,j) = sqrt(ljj);
+    else {
+      if (minljj < minl2) minljj = minl2;
+      if (minljj*minljj - ljj > maxadd) maxadd = minljj*minljj - ljj;
+      L(j,j) = minljj;
+    }
+    for (i = j+1; i <= N; i++) L(i,j) = L(i,j) / L(j,j);
+  }
+}
+
+template<int N>
+void MCholesky(FixedSymMatrix<N>& S, FixedLowerMatrix<N>& L)
+{
+  const double sqrteps = sqrt(DBL_EPSILON);
+  double maxadd = 0.0, maxdiag = 0.0, mindiag = 1.0e10, maxoff = 0.0, mu;
+  int i, j;
+
+  for (i = 1; i <= N; i++) {
+    if (S(i,i) > maxdiag) maxdiag = S(i,i);
+    if (S(i,i) < mindiag) mindiag = S(i,i);
+    if (S(i,i) > maxoff)  maxoff  = S(i,i);
+  }
+
+  double maxposdiag = (maxdiag > 0.0)? maxdiag : 0.0;
+
+  if (mindiag <= sqrteps*maxposdiag) {
+    mu = 2.0*(maxposdiag-mindiag)*sqrteps - mindiag;
+    maxdiag = maxdiag + mu;
+  }
+  else mu = 0.0;
+
+  if (maxoff*(1.0 + 2.0*sqrteps) > maxdiag) {
+    mu = mu + (maxoff-maxdiag) + 2.0*sqrteps*maxoff;
+    maxdiag = maxoff * (1.0 + 2.0*sqrteps);
+  }
+
+  if (maxdiag == 0.0) {
+    mu = 1.0;
+    maxdiag = 1.0;
+  }
+  if (mu > 0.0)
+    for (i = 1; i <= N; i++) S(i,i) = S(i,i) + mu;
+
+  double maxoffl = sqrt((maxdiag >= maxoff/N)? maxdiag : maxoff/N);
+
+  PertChol(S, maxoffl, maxadd, L);
+
+  if (maxadd > 0.0) {
+    double maxev = S(1,1), minev = S(1,1);
+    for (i = 1; i <= N; i++) {
+      double offrow = 0.0;
+      for (j = 1; j <= N; j++) if (j != i) offrow += fabs(S(i,j));
+      if (S(i,i) + offrow > maxev) maxev = S(i,i) + offrow;
+      if (S(i,i) - offrow < minev) minev = S(i,i) - offrow;
+    }
+    double sdd = (maxev - minev)*sqrteps - minev;
+    if (sdd < 0.0) sdd = 0.0;
+    mu = (maxadd <= sdd)? maxadd : sdd;
+    for (i = 1; i <= N; i++) S(i,i) = S(i,i) + mu;
+
+    PertChol(S, 0.0, maxadd, L);
+  }
+}
+
+} // namespace OPTPP
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef OPTPPPROFILE_H
+#define OPTPPPROFILE_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include <iostream>
+
+#include "OptppArray.h"
+#include "OptppThreads.h"
+
+using std::ostream;
+
+namespace OPTPP {
+
+/**
+ * OptppProfile collects per-phase wall clock times and event counters
+ * of an optimization run, both in total and for every iteration.
+ *
+ * A profile is attached with OptimizeClass::setProfile(), which also
+ * hands it to the NLP of the optimizer.  Nothing is recorded, and
+ * the instrumented code only pays for a null pointer test, as long as
+ * no profile is attached.
+ *
+ * Times are inclusive: the FDGradient phase, for example, contains
+ * the FcnEval time of the stencil points.  Iteration records hold the
+ * work done since the previous endIteration() call, so the first one
+ * includes the setup of the optimizer.  Direct searches (PDS, GSS)
+ * record only evaluations and output.  Memory allocations are not
+ * counted.
+ *
+ * Example:
+ *
+ *   OptppProfile prof;
+ *   objfcn.setProfile(&prof);
+ *   objfcn.optimize();
+ *   prof.writeJSON(std::cout);
+ */
+
+class OptppProfile {
+public:
+  /// Timed phases
+  enum Phase { FcnEval, GradEval, HessEval, ConstrEval, FDGradient,
+	       FDHessian, SearchDirection, HessianUpdate, LineSearch,
+	       TrustRegion, Output, NumPhases };
+
+  /// Event counters
+  enum Counter { Fevals, Gevals, Hevals, Cevals, CacheHits,
+		 Factorizations, LinearSolves, NumCounters };
+
+private:
+  double  total_time[NumPhases];
+  double  iter_time[NumPhases];
+  double  start_time[NumPhases];
+  int     depth[NumPhases];
+
+  long    total_count[NumCounters];
+  long    iter_count[NumCounters];
+
+  /// Closed iteration records, NumPhases times then NumCounters counts
+  OptppArray<int>    iter_id;
+  OptppArray<double> history_time;
+  OptppArray<long>   history_count;
+
+  OptppMutex mutex;
+
+  OptppProfile(const OptppProfile&);
+  OptppProfile& operator=(const OptppProfile&);
+
+public:
+  OptppProfile();
+  ~OptppProfile() {}
+
+  /// Forget everything recorded so far
+  void reset();
+
+  /// Enter / leave phase p; nested calls of the same phase count once
+  void start(Phase p);
+  void stop(Phase p);
+
+  /// Add n to counter c
+  void count(Counter c, long n = 1);
+
+  /// Close the record of iteration k
+  void endIteration(int k);
+
+  /// Number of closed iteration records
+  int numIterations() const { return iter_id.length(); }
+  /// Iteration number of record i, i = 0,...,numIterations()-1
+  int getIteration(int i) const { return iter_id[i]; }
+
+  /// Total time spent in phase p
+  double getTime(Phase p) const { return total_time[p]; }
+  /// Time spent in phase p during record i
+  double getTime(int i, Phase p) const
+    { return history_time[i*NumPhases + p]; }
+
+  /// Total value of counter c
+  long getCount(Counter c) const { return total_count[c]; }
+  /// Value of counter c during record i
+  long getCount(int i, Counter c) const
+    { return history_count[i*NumCounters + c]; }
+
+  static const char* phaseName(Phase p);
+  static const char* counterName(Counter c);
+
+  /// Totals and iteration records as a JSON object
+  void writeJSON(ostream& os) const;
+  /// One CSV line per iteration record, headed by the column names
+  void writeCSV(ostream& os) const;
+};
+
+/**
+ * OptppProfileTimer times phase p of a profile for the lifetime of
+ * the object.  It does nothing when prof is null.
+ */
+class OptppProfileTimer {
+  OptppProfile*       prof_;
+  OptppProfile::Phase phase_;
+
+  OptppProfileTimer(const OptppProfileTimer&);
+  OptppProfileTimer& operator=(const OptppProfileTimer&);
+
+public:
+  OptppProfileTimer(OptppProfile* prof, OptppProfile::Phase p):
+    prof_(prof), phase_(p) { if (prof_) prof_->start(phase_);}
+  ~OptppProfileTimer() { if (prof_) prof_->stop(phase_);}
+};
+
+} // namespace OPTPP
+
+#endif
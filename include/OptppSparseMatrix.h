@@ -0,0 +1,103 @@
+#ifndef OPTPPSPARSEMATRIX_H
+#define OPTPPSPARSEMATRIX_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include "include.h"
+#include "newmat.h"
+#include "OptppArray.h"
+
+namespace OPTPP {
+
+/**
+ * OptppSparseMatrix is a real matrix stored by compressed columns.
+ * It holds constraint gradients, an ndim x ncons matrix whose column j
+ * is the gradient of constraint j, so the same arrays are the
+ * compressed rows (CSR) of the constraint Jacobian.
+ *
+ * Entries are given either as triplets with insert(), in any order and
+ * with repeated entries summed, or column by column with
+ * setColumns().  As everywhere in newmat, indices start at 1.
+ */
+
+class OptppSparseMatrix {
+  int nrows_;				///< Number of rows
+  int ncols_;				///< Number of columns
+  /// Entries of column j are colptr_[j-1],...,colptr_[j]-1
+  mutable OptppArray<int>    colptr_;
+  mutable OptppArray<int>    rowind_;	///< Row indices, increasing by column
+  mutable OptppArray<double> values_;	///< Nonzero values
+  /// Triplets inserted since the matrix was last compressed
+  mutable OptppArray<int>    trow_, tcol_;
+  mutable OptppArray<double> tval_;
+
+  /// Merge pending triplets into the compressed columns
+  void compress() const;
+
+public:
+  /// An empty 0 x 0 matrix
+  OptppSparseMatrix();
+  /// An nrows x ncols matrix of zeros
+  OptppSparseMatrix(int nrows, int ncols);
+  /// The nonzero entries of a dense matrix
+  explicit OptppSparseMatrix(const NEWMAT::Matrix& A);
+
+  /// Drop all entries and change the dimensions
+  void reSize(int nrows, int ncols);
+
+  /// Add v to entry (i,j)
+  void insert(int i, int j, double v);
+
+  /**
+   * Replace all entries by compressed columns: the entries of column
+   * j are rowind[k-1], values[k-1] for k = colptr[j-1],...,colptr[j]-1,
+   * with colptr[0] = 1, as in the Harwell-Boeing format
+   */
+  void setColumns(const int* colptr, const int* rowind, const double* values);
+
+  int nrows() const { return nrows_;}
+  int ncols() const { return ncols_;}
+  /// Number of stored entries
+  int nnz() const;
+
+  /// First and one past the last entry of column j
+  int colBegin(int j) const { compress(); return colptr_[j-1];}
+  int colEnd(int j)   const { compress(); return colptr_[j];}
+  /// Row index and value of entry k
+  int    rowIndex(int k) const { return rowind_[k-1];}
+  double value(int k)    const { return values_[k-1];}
+
+  /// Column j as a dense vector
+  NEWMAT::ColumnVector column(int j) const;
+  /// The whole matrix as a dense matrix
+  NEWMAT::Matrix toDense() const;
+
+  /// A*v
+  NEWMAT::ColumnVector operator*(const NEWMAT::ColumnVector& v) const;
+  /// A'*v
+  NEWMAT::ColumnVector transposeTimes(const NEWMAT::ColumnVector& v) const;
+
+  /// Append scale times column j of A as a new last column
+  void appendColumn(const OptppSparseMatrix& A, int j, double scale = 1.0);
+  /// Append all columns of A
+  void appendColumns(const OptppSparseMatrix& A);
+
+  /**
+   * Add scale*A, or scale*A' if transpose is set, to the block of M
+   * whose upper left corner is (row0+1, col0+1)
+   */
+  void addTo(NEWMAT::Matrix& M, int row0, int col0, double scale = 1.0,
+	     bool transpose = false) const;
+};
+
+} // namespace OPTPP
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef OPTPPTHREADS_H
+#define OPTPPTHREADS_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#ifdef WITH_THREADS
+#include <pthread.h>
+#endif
+
+namespace OPTPP {
+
+/**
+ * Task run by parallelFor for each index i = 0,...,n-1.  A nonzero
+ * return value asks parallelFor to stop handing out the remaining
+ * indices; tasks already running are allowed to complete.
+ */
+typedef int (*OPTPP_TASKFCN)(int, void*);
+
+/**
+ * Task run by parallelFor for index i on worker w = 0,...,nthreads-1.
+ * Each worker runs its tasks one after another, so w can select
+ * workspace that is reused across the tasks of one thread.
+ */
+typedef int (*OPTPP_WORKERFCN)(int i, int w, void*);
+
+/**
+ * OptppMutex is a thin wrapper around a POSIX mutex.  When OPT++ is
+ * built without thread support lock() and unlock() do nothing.
+ */
+class OptppMutex {
+#ifdef WITH_THREADS
+  pthread_mutex_t mutex_;
+#endif
+
+  friend class OptppCondition;
+
+  /// Mutexes are not copyable
+  OptppMutex(const OptppMutex&);
+  OptppMutex& operator=(const OptppMutex&);
+
+public:
+  OptppMutex();
+  ~OptppMutex();
+
+  void lock();
+  void unlock();
+};
+
+/**
+ * OptppCondition is a thin wrapper around a POSIX condition variable.
+ * Without thread support wait() returns immediately.
+ */
+class OptppCondition {
+#ifdef WITH_THREADS
+  pthread_cond_t cond_;
+#endif
+
+  OptppCondition(const OptppCondition&);
+  OptppCondition& operator=(const OptppCondition&);
+
+public:
+  OptppCondition();
+  ~OptppCondition();
+
+  /// Atomically release m and wait; m is held again on return
+  void wait(OptppMutex& m);
+  void signal();
+  void broadcast();
+};
+
+/**
+ * OptppLock holds an OptppMutex for the lifetime of the object.
+ */
+class OptppLock {
+  OptppMutex& mutex_;
+
+  OptppLock(const OptppLock&);
+  OptppLock& operator=(const OptppLock&);
+
+public:
+  OptppLock(OptppMutex& m): mutex_(m) { mutex_.lock();}
+  ~OptppLock() { mutex_.unlock();}
+};
+
+/**
+ * @return Number of processors available to this process
+ * (always 1 when OPT++ is built without thread support)
+ */
+int getNumProcs();
+
+/**
+ * Run task(i, data) for i = 0,...,n-1 on up to nthreads threads,
+ * the calling thread included.  Indices are handed out in increasing
+ * order from a shared counter, so with nthreads = 1 the tasks run
+ * serially and in order.
+ *
+ * @return Number of tasks that were started
+ */
+int parallelFor(int n, int nthreads, OPTPP_TASKFCN task, void* data);
+
+/// As above, passing each task the number of the worker running it
+int parallelFor(int n, int nthreads, OPTPP_WORKERFCN task, void* data);
+
+} // namespace OPTPP
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef OPTPPTRACE_H
+#define OPTPPTRACE_H
+
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#ifdef HAVE_STD
+#include <cstdio>
+#else
+#include <stdio.h>
+#endif
+
+namespace OPTPP {
+
+/**
+ * Binary iteration trace
+ *
+ * A trace file starts with a 32 byte header
+ *
+ *   char[8]  magic     "OPTTRACE"
+ *   uint32   byteorder 0x01020304 in the byte order of the writer
+ *   uint32   version   OptppTrace::Version
+ *   uint32   flags     OptppTrace::HasX if the iterates are stored
+ *   int32    n         number of variables
+ *   uint32   recsize   size of one record in bytes
+ *   uint32   reserved
+ *
+ * followed by one fixed size record per iteration
+ *
+ *   int32    iter, fevals, gevals, step_type
+ *   double   f, gnorm, step
+ *   double   x[n]      only with HasX
+ *
+ * All values are written in the byte order of the writer; readers
+ * swap when the byteorder tag says so.  Readers should skip recsize
+ * bytes per record, so that later versions can append fields.
+ */
+
+struct OptppTraceRecord {
+  int    iter;
+  int    fevals;
+  int    gevals;
+  int    step_type;
+  double f;
+  double gnorm;
+  double step;
+};
+
+/**
+ * OptppTrace writes a binary iteration trace through a private buffer,
+ * so that a record costs a few memcpy calls instead of formatted text
+ * output.
+ */
+class OptppTrace {
+public:
+  enum { Version = 1, HasX = 1, HeaderSize = 32, BufferSize = 65536 };
+
+private:
+  FILE*  fp;
+  int    n;
+  bool   storeX;
+  char*  buf;
+  size_t used;
+  size_t recsize;
+
+  void put(const void* p, size_t len);
+
+  OptppTrace(const OptppTrace&);
+  OptppTrace& operator=(const OptppTrace&);
+
+public:
+  OptppTrace(): fp(0), n(0), storeX(false), buf(0), used(0), recsize(0) {}
+  ~OptppTrace() { close();}
+
+  /**
+   * Create filename and write the header for an n-dimensional
+   * problem; withX also stores the iterate in every record.
+   * @return false if the file cannot be opened
+   */
+  bool open(const char* filename, int n, bool withX = false);
+  /// Flush the buffer and close the file
+  void close();
+  bool isOpen() const { return fp != 0;}
+
+  /// Append one record; x (n values) is only used if the trace stores x
+  void write(const OptppTraceRecord& rec, const double* x = 0);
+  /// Write the buffered records to the file
+  void flush();
+};
+
+/**
+ * OptppTraceReader reads back a file written by OptppTrace.
+ */
+class OptppTraceReader {
+  FILE*    fp;
+  int      n;
+  unsigned version;
+  unsigned flags;
+  size_t   recsize;
+  bool     swap;
+  char*    rec;
+
+  OptppTraceReader(const OptppTraceReader&);
+  OptppTraceReader& operator=(const OptppTraceReader&);
+
+public:
+  OptppTraceReader(): fp(0), n(0), version(0), flags(0), recsize(0),
+		      swap(false), rec(0) {}
+  ~OptppTraceReader() { close();}
+
+  /// @return false if filename is not a readable trace
+  bool open(const char* filename);
+  void close();
+
+  int      getDim()     const { return n;}
+  unsigned getVersion() const { return version;}
+  bool     hasX()       const { return (flags & OptppTrace::HasX) != 0;}
+
+  /**
+   * Read the next record; x must hold getDim() values if hasX().
+   * @return false at the end of the file
+   */
+  bool next(OptppTraceRecord& r, double* x = 0);
+};
+
+} // namespace OPTPP
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef PSNLF_h
+#define PSNLF_h
+/*----------------------------------------------------------------------
+ Copyright (c) 2001, Sandia Corporation.   Under the terms of Contract
+ DE-AC04-94AL85000, there is a non-exclusive license for use of this
+ work by or on behalf of the U.S. Government.
+ ----------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
+#include "NLP2.h"
+
+extern "C" {
+  double get_cpu_time();
+  double get_wall_clock_time();
+}
+
+namespace OPTPP {
+
+typedef void (*INITFCN)(int, NEWMAT::ColumnVector&);
+
+typedef CompoundConstraint* (*INITCONFCN)(int);
+
+/**
+ * Element function e of a partially separable objective.  xe holds
+ * the nev variables of the element, in the order given to addElement;
+ * as mode requests, fe, the gradient ge and the Hessian He with
+ * respect to xe are returned.
+ */
+typedef void (*USERFCNPS)(int mode, int e, int nev,
+  const NEWMAT::ColumnVector& xe, real& fe, NEWMAT::ColumnVector& ge,
+  NEWMAT::SymmetricMatrix& He, int& result, void* v);
+
+/**
+ * PSNLF is a derived class of NLP2 for partially separable objectives
+ *
+ *      f(x) = f_1(U_1 x) + ... + f_m(U_m x),
+ *
+ * where each element f_e depends on a few variables only, selected by
+ * U_e.  The elements are evaluated separately, on up to
+ * getNumThreads() threads, and their gradients and Hessians are
+ * scattered into the full ones.  OptQNewton keeps one small BFGS
+ * matrix per element for a PSNLF (partitioned quasi-Newton updates).
+ *
+ * Element Hessians are only requested by methods that use the
+ * Hessian, e.g. OptNewton.
+ */
+
+class PSNLF: public NLP2 {
+
+protected:
+  USERFCNPS fcn;		///< User-defined element functions
+  INITFCN init_fcn;		///< User-defined initfcn for the obj. function
+  INITCONFCN init_confcn;	///< User-defined initfcn for the constraints
+  bool init_flag;		///< Has the function been initialized?
+  void* vptr;			///< Void pointer passed to fcn
+  /// Variables of element e are elvar[elptr[e-1]-1],...,elvar[elptr[e]-2]
+  OptppArray<int> elptr;
+  OptppArray<int> elvar;	///< Element variables, 1-based
+  OptppArray<NEWMAT::ColumnVector> elgrad; ///< Element gradients at elgrad_x
+  NEWMAT::ColumnVector elgrad_x;	///< Point of elgrad
+
+public:
+  // Constructors
+  PSNLF():
+    NLP2(), fcn(0), init_fcn(0), init_confcn(0), init_flag(false),
+    vptr(0), elptr(1, 1) {;}
+  PSNLF(int ndim, USERFCNPS f, INITFCN i,
+	CompoundConstraint* constraint = 0, void* v = 0):
+    NLP2(ndim, constraint), fcn(f), init_fcn(i), init_confcn(0),
+    init_flag(false), vptr(v), elptr(1, 1) {;}
+  PSNLF(int ndim, USERFCNPS f, INITFCN i, INITCONFCN c, void* v = 0):
+    NLP2(ndim), fcn(f), init_fcn(i), init_confcn(c), init_flag(false),
+    vptr(v), elptr(1, 1)
+    {constraint_ = init_confcn(ndim);}
+
+  // Destructor
+  virtual ~PSNLF(){;}
+
+  /**
+   * Add an element depending on variables vars[0],...,vars[nev-1]
+   * (1-based, no repeats)
+   * @return Number of the new element, from 1
+   */
+  int addElement(int nev, const int* vars);
+  /// Number of elements
+  int getNumElements() const {return elptr.length() - 1;}
+  /// Number of variables of element e
+  int getElementSize(int e) const {return elptr[e] - elptr[e-1];}
+  /// Variable j (from 1) of element e
+  int getElementVariable(int e, int j) const
+    {return elvar[elptr[e-1] + j - 2];}
+  /**
+   * Gradients of the elements with respect to their own variables at
+   * x; kept from the last gradient evaluation at x when possible
+   */
+  const OptppArray<NEWMAT::ColumnVector>&
+    evalElementGradients(const NEWMAT::ColumnVector& x);
+
+  /// Reset parameters
+  virtual void reset();
+  /// Initialize selected function
+  virtual void initFcn();
+  /// Evaluate the function, gradient, and Hessian
+  virtual void eval();
+  /// Evaluate the function
+  virtual real evalF();
+  /// Evaluate the function at x
+  virtual real evalF(const NEWMAT::ColumnVector& x);
+  /// Call the element functions at x without updating the problem state
+  virtual bool evalFRaw(const NEWMAT::ColumnVector& x, real& fx);
+  /// Evaluate the gradient
+  virtual NEWMAT::ColumnVector evalG();
+  /// Evaluate the gradient at x
+  virtual NEWMAT::ColumnVector evalG(const NEWMAT::ColumnVector& x);
+  /// Evaluate the Hessian
+  virtual NEWMAT::SymmetricMatrix evalH();
+  /// Evaluate the Hessian at x
+  virtual NEWMAT::SymmetricMatrix evalH(NEWMAT::ColumnVector& x);
+
+  /// Evaluate the Lagrangian at x
+  virtual real evalLagrangian(const NEWMAT::ColumnVector& x,
+    NEWMAT::ColumnVector& mult, const NEWMAT::ColumnVector& type) ;
+  /// Evaluate the gradient of the Lagrangian at x
+  virtual NEWMAT::ColumnVector evalLagrangianGradient(const NEWMAT::ColumnVector& x, const NEWMAT::ColumnVector& mult, const NEWMAT::ColumnVector& type) ;
+
+  /// Evaluate nonlinear constraints at x
+  virtual NEWMAT::ColumnVector evalCF(const NEWMAT::ColumnVector& x);
+  /// Evaluate gradient of nonlinear constraints at x
+  virtual NEWMAT::Matrix evalCG(const NEWMAT::ColumnVector& x);
+private:
+  /// Evaluate constraint hessian at x
+  virtual NEWMAT::SymmetricMatrix evalCH(NEWMAT::ColumnVector &x);
+  virtual OptppArray<NEWMAT::SymmetricMatrix> evalCH(NEWMAT::ColumnVector &x,
+    int darg);
+  virtual void evalC(const NEWMAT::ColumnVector& x);
+
+  /**
+   * Evaluate the elements at x on up to nthr threads and sum them into
+   * fx, gx and Hx as mode requests; the element gradients are
+   * returned in eg if it is not null
+   */
+  void evalElements(int mode, const NEWMAT::ColumnVector& x, real& fx,
+    NEWMAT::ColumnVector& gx, NEWMAT::SymmetricMatrix& Hx, int& result,
+    int nthr, OptppArray<NEWMAT::ColumnVector>* eg);
+  static int elementTask(int e, void* v);
+};
+
+} // namespace OPTPP
+
+#endif
@@ -5,6 +5,10 @@
  *
  *********************************************************************/
 
+#ifndef OPTPP_THREAD_LOCAL
+#define OPTPP_THREAD_LOCAL
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,7 +48,7 @@ namespace OPTPP {
 
 typedef double real;
 
-typedef enum {LineSearch, TrustRegion, TrustPDS } 
+typedef enum {LineSearch, TrustRegion, TrustPDS, ParallelLineSearch } 
              SearchStrategy;
 
 typedef enum {Cauchy_Step, Dogleg_Step, Newton_Step, Backtrack_Step} 
@@ -69,6 +69,9 @@ typedef enum {NoSpec, Spec1, Spec2} SpecOption;
 
 typedef void (*UPDATEFCN)(int, int, NEWMAT::ColumnVector);
 
+/// Asked after iteration k at the point x with value f whether to stop
+typedef bool (*STOPFCN)(int, double, const NEWMAT::ColumnVector&, void*);
+
 struct OPT_GLOBALS {
   static const float OPT_VERSION;
   static const int OPT_MINOR;
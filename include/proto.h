@@ -32,7 +32,7 @@ int depth(int, int, int);
 
 int pdseql(int, double, double *);
      
-int pdsget(int, FILE *, int *, double *, int *, char *);
+int pdsget(int, int *, int *, double *, int *, char *);
 
 int pdsglb(int, double *, double *, char *);
 
@@ -40,22 +40,16 @@ int pdsgop(double *, int, double *, char *);
 
 int pdshrk(int, int, int *, int *);
 
-int make_search(int, int, int *, int *, int *, int *, int *, int *,
-		int *);
+int make_search(int, int *, int *, int *, int *, int *, int *, int *,
+		int);
 
 double pdslen(int, int, double *, double, double *);
 
-int order(int, int *, int *);
-
-int quick(int, int *, int *);
-
 int pdsrgt(int, double, double *);
 
 int pdscld(int, double, double *);
 
-int sort(int, int *, int *, int *, int *);
-
-int writes(int, int, int, int, int, int *, int *);
+int writes(int *, int, int, int, int, int *, int *);
 
 int pdsdgn(int, double *, double *, double *, double *, int *, double *);
 
@@ -7,6 +7,10 @@
 #include "OPT++_config.h"
 #endif
 
+#ifndef OPTPP_THREAD_LOCAL              // storage class of the exception
+#define OPTPP_THREAD_LOCAL              // and clean-up lists; per thread
+#endif                                  // in threaded OPT++ builds
+
 #ifdef HAVE_NAMESPACES
 #define use_namespace                   // define name spaces
 #endif
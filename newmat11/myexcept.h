@@ -65,7 +65,7 @@ public:
    void ReName(const char*);
    static void PrintTrace();             // for printing trace
    static void AddTrace();               // insert trace in exception record
-   static Tracer* last;                  // points to Tracer list
+   static OPTPP_THREAD_LOCAL Tracer* last;  // points to Tracer list
    friend class BaseException;
 };
 
@@ -73,14 +73,14 @@ public:
 class BaseException                          // The base exception class
 {
 protected:
-   static char* what_error;              // error message
-   static int SoFar;                     // no. characters already entered
-   static int LastOne;                   // last location in error buffer
+   static OPTPP_THREAD_LOCAL char* what_error;  // error message
+   static OPTPP_THREAD_LOCAL int SoFar;  // no. characters already entered
+   static OPTPP_THREAD_LOCAL int LastOne;  // last location in error buffer
 public:
    static void AddMessage(const char* a_what);
                                          // messages about exception
    static void AddInt(int value);        // integer to error message
-   static unsigned long Select;          // for identifying exception
+   static OPTPP_THREAD_LOCAL unsigned long Select;  // for identifying exception
    BaseException(const char* a_what = 0);
    static const char* what() { return what_error; }
                                          // for getting error message
@@ -110,8 +110,10 @@ class Janitor;
 class JumpBase         // pointer to a linked list of jmp_buf s
 {
 public:
-   static JumpItem *jl;
-   static jmp_buf env;
+   static OPTPP_THREAD_LOCAL JumpItem *jl;
+   static OPTPP_THREAD_LOCAL jmp_buf env;
+   static JumpItem* Top();            // jl, created on first use in a thread
+                                      // and deleted when the thread exits
 };
 
 class JumpItem         // an item in a linked list of jmp_buf s
@@ -131,7 +133,7 @@ void Throw();
 inline void Throw(const BaseException&) { Throw(); }
 
 #define Try                                             \
-   if (!setjmp( JumpBase::jl->env )) {                  \
+   if (!setjmp( JumpBase::Top()->env )) {               \
    JumpBase::jl->trace = Tracer::last;               \
    JumpItem JI387256156;
 
@@ -150,7 +152,7 @@ inline void Throw(const BaseException&) { Throw(); }
 class Janitor
 {
 protected:
-   static bool do_not_link;                  // set when new is called
+   static OPTPP_THREAD_LOCAL bool do_not_link;  // set when new is called
    bool OnStack;                             // false if created by new
 public:
    Janitor* NextJanitor;
@@ -348,42 +350,42 @@ public:                                                                    \
 class Logic_error : public BaseException
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Logic_error(const char* a_what = 0);
 };
 
 class Runtime_error : public BaseException
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Runtime_error(const char* a_what = 0);
 };
 
 class Domain_error : public Logic_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Domain_error(const char* a_what = 0);
 };
 
 class Invalid_argument : public Logic_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Invalid_argument(const char* a_what = 0);
 };
 
 class Length_error : public Logic_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Length_error(const char* a_what = 0);
 };
 
 class Out_of_range : public Logic_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Out_of_range(const char* a_what = 0);
 };
 
@@ -404,21 +406,21 @@ public:
 class Range_error : public Runtime_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Range_error(const char* a_what = 0);
 };
 
 class Overflow_error : public Runtime_error
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Overflow_error(const char* a_what = 0);
 };
 
 class Bad_alloc : public BaseException
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    Bad_alloc(const char* a_what = 0);
 };
 
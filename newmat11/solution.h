@@ -43,7 +43,7 @@ public:
 class SolutionException : public BaseException
 {
 public:
-   static unsigned long Select;
+   static OPTPP_THREAD_LOCAL unsigned long Select;
    SolutionException(const char* a_what = 0);
 };
 
@@ -106,15 +106,15 @@ int dqrdc(double *x, int ldx, int ndim, int p, double *qraux,
 
   /* Local variables */
 
-  static long int negj;
-  static int maxj;
-  static int j, l;
-  static double t;
-  static long int swapj;
-  static double nrmxl;
-  static int jj, jp, pl, pu;
-  static double tt, maxnrm;
-  static int lp1, lup;
+  long int negj;
+  int maxj;
+  int j, l;
+  double t;
+  long int swapj;
+  double nrmxl;
+  int jj, jp, pl, pu;
+  double tt, maxnrm;
+  int lp1, lup;
 
   /* Parameter adjustments */
 
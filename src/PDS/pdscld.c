@@ -58,7 +58,7 @@ int pdscld(int ndim, double scale, double *simplex)
    *
    *******************************************************************/
 
-  static int i, j;
+  int i, j;
 
   for (j = 1; j <= ndim; j++) {
 
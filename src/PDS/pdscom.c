@@ -12,7 +12,7 @@
 #include "pds.h"
 #include "common.h"
 
-extern struct pdscon pdscon;
+extern OPTPP_THREAD_LOCAL struct pdscon pdscon;
 
 #ifdef WITH_MPI
 MPI_Op pdswapOpNum;
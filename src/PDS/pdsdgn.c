@@ -47,11 +47,11 @@ int pdsdgn(int ndim, double *s, double *a, double *work1,
 
   /* Local variables */
 
-  static int i, j, k;
+  int i, j, k;
 
   /* Form the matrix of edges adjacent to the initial vertex. */
 
-  static int one = 1;
+  int one = 1;
     
   for (j = 0; j < ndim; j++) {
     k = j + 1;
@@ -77,8 +77,8 @@ int pdsdone(int maxitr, int count, int n, double stol, double *length,
 
   /* Local variables */
 
-  static double norm;
-  static double delta, deltaf, rftol;
+  double norm;
+  double delta, deltaf, rftol;
 
 #ifdef WITH_MPI
 
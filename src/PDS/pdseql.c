@@ -73,9 +73,9 @@ int pdseql(int ndim, double scale, double *simplex)
    *
    *******************************************************************/
 
-  static double temp;
-  static int i, j;
-  static double p, q;
+  double temp;
+  int i, j;
+  double p, q;
 
   temp = ndim + 1.;
   q = ((sqrt(temp) - 1.) / (ndim * sqrt(2.))) * scale;
@@ -5,7 +5,6 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <unistd.h>
 #include <math.h>
 #include <string.h>
 
@@ -16,19 +15,15 @@
 #include "pds.h"
 #include "common.h"
 
-#ifndef READ_TYPE
-#define READ_TYPE (void *)
-#endif
-
-extern struct pdscon pdscon;
+extern OPTPP_THREAD_LOCAL struct pdscon pdscon;
 
-int pdsget(int ndim, FILE *fpin, int *sss, double *factor, int *beta,
+int pdsget(int ndim, int *header, int *sss, double *factor, int *beta,
 	   char *emesg)
 {
   /*******************************************************************
    *
-   * This is the subroutine used to read in the search scheme for the
-   * parallel direct search methods.
+   * This is the subroutine used to check the header of the search
+   * scheme for the parallel direct search methods.
    *
    * Written by Virginia Torczon. 
    * MPI version written by David Serafini. 
@@ -41,8 +36,8 @@ int pdsget(int ndim, FILE *fpin, int *sss, double *factor, int *beta,
    *
    *       N             dimension of the problem to be solved 
    *
-   *       IN            unit number from which the scheme is to be
-   *                     read
+   *       HEADER        the first four integers of the in-memory
+   *                     search scheme (see WRITES)
    *
    *       SSS           size of the search scheme (the number of
    *                     points to be considered at each iteration)
@@ -86,14 +81,9 @@ int pdsget(int ndim, FILE *fpin, int *sss, double *factor, int *beta,
   /* Variables */
 
   int error;
-  int header[4];
 
   error = 0;
 
-  /* Read in 4 bytes */
-
-  fread(READ_TYPE &header[0], INT_SIZE, 4, fpin);
-
   /* HEADER should hold:
    *    N, 
    *    TOTAL (number of points in the search file),
@@ -1,8 +1,12 @@
 
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
 #include "pds.h"
 #include "common.h"
 
-extern struct pdscon pdscon;
+extern OPTPP_THREAD_LOCAL struct pdscon pdscon;
 
 int pdsglb(int ndim, double *mybest, double *yourbest, char *emesg)
 {
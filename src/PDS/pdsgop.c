@@ -1,4 +1,8 @@
 
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
 #include <string.h>
 
 #include "mpi.h"
@@ -7,7 +11,7 @@
 #include "cblas.h"
 #include "common.h"
 
-extern struct pdscon pdscon;
+extern OPTPP_THREAD_LOCAL struct pdscon pdscon;
 extern MPI_Op pdswapOpNum;
 
 int pdsgop(double *mybest, int sizee, double *yourbest, char *emesg)
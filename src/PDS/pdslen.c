@@ -45,8 +45,8 @@ double pdslen(int ndim, int type, double *s, double scale,
 
   /* Local variables */
 
-  static double temp;
-  static int i, j, k;
+  double temp;
+  int i, j, k;
   int incx = 1;
 
   if (type == 1) {
@@ -57,7 +57,7 @@ int pdsrgt(int ndim, double scale, double *simplex)
    *
    *******************************************************************/
 
-  static int i, j;
+  int i, j;
 
   for (j = 1; j <= ndim; j++) {
 
@@ -56,9 +56,9 @@ int pdsupd(long int worked, int best, int n, int *index, double *s,
 
   /* Local variables */
 
-  static int temp;
-  static double a;
-  static int i, j, vj;
+  int temp;
+  double a;
+  int i, j, vj;
 
   /* Function Body */
 
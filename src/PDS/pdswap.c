@@ -1,4 +1,8 @@
 
+#ifdef HAVE_CONFIG_H
+#include "OPT++_config.h"
+#endif
+
 #include <math.h>
 
 #include "mpi.h"
@@ -7,7 +11,7 @@
 #include "cblas.h"
 #include "common.h"
 
-extern struct pdscon pdscon;
+extern OPTPP_THREAD_LOCAL struct pdscon pdscon;
 
 void pdswap(double *yourbest, double *mybest, int *len,
 	    MPI_Datatype *type)
@@ -7,22 +7,22 @@
 //--------------------------------------------------------------------
 */
 
-#include <unistd.h>
-
 #include "pds.h"
 
 #define A 	-1
 #define BEST 	0
 
-int writes(int out, int ndim, int unique, int factor, int beta, 
+int writes(int *out, int ndim, int unique, int factor, int beta, 
 	   int *scheme, int *list)
 {
   /*******************************************************************
    *
-   * Write the points in the search scheme out to an unformatted
-   * fortran file for later use by the parallel direct search methods.
-   * note that before the points in the search strategy are written
-   * out to a file, we write out four pieces of "header" information:
+   * Write the points in the search scheme out to memory for later use
+   * by the parallel direct search methods.  The layout is that of the
+   * old unformatted scheme file, so the array can be written to (or
+   * read back from) disk as a single block.  note that before the
+   * points in the search strategy are written out, we write out four
+   * pieces of "header" information:
    * n, unique, factor, and beta.  the first two pieces are for error
    * checking when the file is later used by the parallel direct
    * search methods; the second two pieces of information are used to
@@ -31,8 +31,8 @@ int writes(int out, int ndim, int unique, int factor, int beta,
    *  
    * Arguments:
    *
-   *    out           file descriptor to which the scheme is to be
-   *                  written
+   *    out           array to which the scheme is to be written; it
+   *                  must hold at least 4 + unique*(n+2) integers
    *
    *    n             dimension used to generate the search scheme
    *
@@ -59,12 +59,7 @@ int writes(int out, int ndim, int unique, int factor, int beta,
    *
    *    list          index array used to point to the unique n-tuples
    *                  in the search scheme; the ones actually to be
-   *                  written out to the file
-   *
-   * Note that on the intel distributed memory machines it is *much*
-   * faster to aggregate data on the node and write it out to the file
-   * as a single block than to write out a piece at a time when using
-   * the intel library routines for i/0.
+   *                  written out
    *
    *******************************************************************/
 
@@ -75,7 +70,6 @@ int writes(int out, int ndim, int unique, int factor, int beta,
     /* Local variables. */
 
     int i, j;
-    int error = 0;
 
     /* Parameter adjustments. */
 
@@ -86,25 +80,22 @@ int writes(int out, int ndim, int unique, int factor, int beta,
 
     /* Write out header information. */
 
-    error = write (out, WRITE_TYPE &ndim,   INT_SIZE);
-    error = write (out, WRITE_TYPE &unique, INT_SIZE);
-    error = write (out, WRITE_TYPE &factor, INT_SIZE);
-    error = write (out, WRITE_TYPE &beta,   INT_SIZE);
+    *out++ = ndim;
+    *out++ = unique;
+    *out++ = factor;
+    *out++ = beta;
 
     /* Write out the SCHEME data. */
     
     for (i = 1; i <= unique; ++i) {
-      error = write(out, WRITE_TYPE &scheme[list[i] * scheme_dim1 - 1],4);
-      error = write(out, WRITE_TYPE &scheme[list[i] * scheme_dim1],4);
+      *out++ = scheme[list[i] * scheme_dim1 - 1];
+      *out++ = scheme[list[i] * scheme_dim1];
 
       for (j = 1; j <= ndim; ++j) {
-	error = write(out,WRITE_TYPE &scheme[j + list[i] * scheme_dim1],4);
+	*out++ = scheme[j + list[i] * scheme_dim1];
       }
     }
 
-    if (error == -1) 
-      return error;
-    else
-      return 0;
+    return 0;
 }
 
@@ -8,7 +8,7 @@ void daxpy(int *ndim, double *alpha, double *dx, int *inc1,
      
 {
   /* Local variables */
-  static int i, m, ix, iy;
+  int i, m, ix, iy;
   int n = *ndim, incx = *inc1, incy = *inc2;
   double da = *alpha;
 
@@ -64,9 +64,9 @@ void dswap(int *ndim, double *dx, int *inc1, double *dy, int *inc2)
 
 {
   /* Local variables */
-  static int i, m;
-  static double dtemp;
-  static int ix, iy;
+  int i, m;
+  double dtemp;
+  int ix, iy;
   int n = *ndim, incx = *inc1, incy = *inc2;
   
   /* Function Body */
@@ -178,7 +178,7 @@ void dscal(int *ndim, double *alpha, double *dx, int *inc1)
 {
 
   /* Local variables */
-  static int i, m, ix;
+  int i, m, ix;
   int n = *ndim, incx = *inc1;
   double da = *alpha;
 
@@ -247,7 +247,7 @@ void dcopy(int *ndim, double *dx, int *inc1, double *dy, int *inc2)
 
 {
     /* Local variables */
-    static int i, m, ix, iy;
+    int i, m, ix, iy;
     int n = *ndim, incx = *inc1, incy = *inc2;
 
     /* Function Body */